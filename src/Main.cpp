@@ -1,11 +1,50 @@
+#include <fstream>
+#include <string>
+
 #include "GameFactory.h"
+#include "InputRecordingReader.h"
+#include "InputSfml.h"
+#include "TimerFactory.h"
 //#include "Windows.h"
 
-int main()
+namespace
+{
+const std::string recordOption{"--record"};
+const std::string replayOption{"--replay"};
+
+void replay(const std::string& recordingPath)
+{
+    std::ifstream recording{recordingPath, std::ios::binary};
+    input::ReplayInputManager replayInputManager{std::make_unique<input::InputSfml>(),
+                                                 input::InputRecordingReader::read(recording)};
+
+    // game timers have to follow recorded frames from the very first state
+    const auto clock = std::make_shared<utils::SimulationClock>();
+    utils::TimerFactory::useSimulationClock(clock);
+
+    auto game = game::GameFactory::createHeadlessGame();
+    std::cout << game->replay(replayInputManager, *clock) << std::endl;
+}
+}
+
+int main(int argc, char* argv[])
 {
     try
     {
+        if (argc == 3 and argv[1] == replayOption)
+        {
+            replay(argv[2]);
+            return 0;
+        }
+
         auto game = game::GameFactory::createGame();
+
+        if (argc == 3 and argv[1] == recordOption)
+        {
+            game->startRecording(std::make_unique<input::InputRecorder>(
+                std::make_unique<std::ofstream>(argv[2], std::ios::binary)));
+        }
+
         game->run();
     }
     catch (const std::exception& err)
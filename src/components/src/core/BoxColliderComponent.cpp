@@ -22,6 +22,7 @@ BoxColliderComponent::BoxColliderComponent(ComponentOwner* owner, const utils::V
       offset{offsetInit},
       movementComponent{std::move(movementComponentInit)},
       size{sizeInit},
+      currentDeltaTime{0},
       currentColliderOnXAxis{nullptr}
 {
     collisionBoundaries.width = sizeInit.x;
@@ -56,42 +57,49 @@ bool BoxColliderComponent::intersects(const utils::Vector2f& point)
 
 bool BoxColliderComponent::intersectsX(const std::shared_ptr<BoxColliderComponent>& other)
 {
-    if (other)
-    {
-        const auto& thisRect = getNextFrameXCollisionBox();
-        const auto& otherRect = other->getNextFrameXCollisionBox();
+    return other and intersectsX(*other);
+}
 
-        if (thisRect.intersects(otherRect))
-        {
-            return true;
-        }
-    }
-    return false;
+bool BoxColliderComponent::intersectsX(BoxColliderComponent& other)
+{
+    const auto& thisRect = getNextFrameXCollisionBox();
+    const auto& otherRect = other.getNextFrameXCollisionBox();
+
+    return thisRect.intersects(otherRect);
 }
 
 bool BoxColliderComponent::intersectsY(const std::shared_ptr<BoxColliderComponent>& other)
 {
-    if (other)
-    {
-        const auto& thisRect = getNextFrameYCollisionBox();
-        const auto& otherRect = other->getNextFrameYCollisionBox();
+    return other and intersectsY(*other);
+}
 
-        if (thisRect.intersects(otherRect))
-        {
-            return true;
-        }
-    }
-    return false;
+bool BoxColliderComponent::intersectsY(BoxColliderComponent& other)
+{
+    const auto& thisRect = getNextFrameYCollisionBox();
+    const auto& otherRect = other.getNextFrameYCollisionBox();
+
+    return thisRect.intersects(otherRect);
 }
 
 void BoxColliderComponent::resolveOverlapX(const std::shared_ptr<BoxColliderComponent>& other)
+{
+    resolveOverlapX(*other);
+}
+
+void BoxColliderComponent::resolveOverlapX(BoxColliderComponent& other)
+{
+    resolveOverlapX(other, other.getNextFrameXCollisionBox());
+}
+
+void BoxColliderComponent::resolveOverlapX(const BoxColliderComponent& other,
+                                           const utils::FloatRect& otherNextFrameXCollisionBox)
 {
     if (not movementComponent)
     {
         return;
     }
 
-    const auto& otherRect = other->getNextFrameXCollisionBox();
+    const auto& otherRect = otherNextFrameXCollisionBox;
 
     const auto left = std::abs(otherRect.left + otherRect.width - nextFrameCollisionBoundaries.left);
     const auto right =
@@ -100,38 +108,48 @@ void BoxColliderComponent::resolveOverlapX(const std::shared_ptr<BoxColliderComp
     if (left < right)
     {
         movementComponent->blockMoveLeft();
-        colliderNamesWithDistancesOnXAxis[other->getOwnerName()] = Direction::Left;
+        contactsOnXAxis.recordContact(other.getOwnerId(), Direction::Left);
     }
     else
     {
         movementComponent->blockMoveRight();
-        colliderNamesWithDistancesOnXAxis[other->getOwnerName()] = Direction::Right;
+        contactsOnXAxis.recordContact(other.getOwnerId(), Direction::Right);
     }
 
-    currentColliderOnXAxis = other->owner;
+    currentColliderOnXAxis = other.owner;
 }
 
 void BoxColliderComponent::resolveOverlapY(const std::shared_ptr<BoxColliderComponent>& other)
+{
+    resolveOverlapY(*other);
+}
+
+void BoxColliderComponent::resolveOverlapY(BoxColliderComponent& other)
+{
+    resolveOverlapY(other, other.getNextFrameXCollisionBox());
+}
+
+void BoxColliderComponent::resolveOverlapY(const BoxColliderComponent& other,
+                                           const utils::FloatRect& otherNextFrameXCollisionBox)
 {
     if (not movementComponent)
     {
         return;
     }
 
-    const auto& otherRect = other->getNextFrameXCollisionBox();
+    const auto& otherRect = otherNextFrameXCollisionBox;
 
     const auto top = std::abs(otherRect.top + otherRect.height - nextFrameCollisionBoundaries.top);
     const auto bot =
         std::abs(otherRect.top - (nextFrameCollisionBoundaries.top + nextFrameCollisionBoundaries.height));
 
-    const auto collidesWithOtherColliderOnXAxis =
-        colliderNamesWithDistancesOnXAxis.contains(other->getOwnerName());
+    const auto contactOnXAxis = contactsOnXAxis.getCurrentContact(other.getOwnerId());
 
     if (nextFrameCollisionBoundaries.top + nextFrameCollisionBoundaries.height / 2 <
-            other->getOwner().transform->getPosition().y and
-        collidesWithOtherColliderOnXAxis)
+            other.getOwner().transform->getPosition().y and
+        contactOnXAxis)
     {
-        if (colliderNamesWithDistancesOnXAxis[other->getOwnerName()] == Direction::Left)
+        if (contactOnXAxis->direction == Direction::Left)
         {
             movementComponent->allowMoveLeft();
         }
@@ -151,6 +169,45 @@ void BoxColliderComponent::resolveOverlapY(const std::shared_ptr<BoxColliderComp
     }
 }
 
+void BoxColliderComponent::resolveSweptHitX(const BoxColliderComponent& other,
+                                            const utils::Vector2f& hitNormal)
+{
+    if (not movementComponent)
+    {
+        return;
+    }
+
+    if (hitNormal.x > 0)
+    {
+        movementComponent->blockMoveLeft();
+        contactsOnXAxis.recordContact(other.getOwnerId(), Direction::Left);
+    }
+    else
+    {
+        movementComponent->blockMoveRight();
+        contactsOnXAxis.recordContact(other.getOwnerId(), Direction::Right);
+    }
+
+    currentColliderOnXAxis = other.owner;
+}
+
+void BoxColliderComponent::resolveSweptHitY(const utils::Vector2f& hitNormal)
+{
+    if (not movementComponent)
+    {
+        return;
+    }
+
+    if (hitNormal.y > 0)
+    {
+        movementComponent->blockMoveUp();
+    }
+    else
+    {
+        movementComponent->blockMoveDown();
+    }
+}
+
 const sf::FloatRect& BoxColliderComponent::getCollisionBox()
 {
     const auto& position = owner->transform->getPosition();
@@ -161,9 +218,10 @@ const sf::FloatRect& BoxColliderComponent::getCollisionBox()
 
 void BoxColliderComponent::setAvailableMovementDirections()
 {
+    contactsOnXAxis.startFrame();
+
     if (movementComponent)
     {
-        colliderNamesWithDistancesOnXAxis.clear();
         movementComponent->allowMoveRight();
         movementComponent->allowMoveLeft();
         movementComponent->allowMoveUp();
@@ -236,4 +294,9 @@ void BoxColliderComponent::setColliderOnXAxis(ComponentOwner* collider)
     currentColliderOnXAxis = collider;
 }
 
+const ColliderContacts& BoxColliderComponent::getContactsOnXAxis() const
+{
+    return contactsOnXAxis;
+}
+
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <optional>
 
+#include "ColliderContacts.h"
 #include "CollisionLayer.h"
 #include "MovementComponent.h"
 #include "Rect.h"
@@ -9,11 +10,6 @@
 
 namespace components::core
 {
-enum class Direction
-{
-    Left,
-    Right
-};
 class BoxColliderComponent : public Component
 {
 public:
@@ -26,9 +22,19 @@ public:
     void loadDependentComponents() override;
     bool intersects(const utils::Vector2f&);
     bool intersectsX(const std::shared_ptr<BoxColliderComponent>&);
+    bool intersectsX(BoxColliderComponent&);
     bool intersectsY(const std::shared_ptr<BoxColliderComponent>&);
+    bool intersectsY(BoxColliderComponent&);
     void resolveOverlapX(const std::shared_ptr<BoxColliderComponent>&);
+    void resolveOverlapX(BoxColliderComponent&);
+    // next frame x collision box of other collider is computed beforehand, so other collider is not modified
+    void resolveOverlapX(const BoxColliderComponent&, const utils::FloatRect& otherNextFrameXCollisionBox);
     void resolveOverlapY(const std::shared_ptr<BoxColliderComponent>&);
+    void resolveOverlapY(BoxColliderComponent&);
+    void resolveOverlapY(const BoxColliderComponent&, const utils::FloatRect& otherNextFrameXCollisionBox);
+    // blocks movement against normal of hit found by sweeping collider along its velocity
+    void resolveSweptHitX(const BoxColliderComponent&, const utils::Vector2f& hitNormal);
+    void resolveSweptHitY(const utils::Vector2f& hitNormal);
     void setAvailableMovementDirections();
     const utils::FloatRect& getCollisionBox();
     const utils::FloatRect& getNextFrameXCollisionBox();
@@ -39,6 +45,7 @@ public:
     void setCollisionLayer(CollisionLayer layer);
     ComponentOwner* getCurrentColliderOnXAxis() const;
     void setColliderOnXAxis(ComponentOwner*);
+    const ColliderContacts& getContactsOnXAxis() const;
 
 private:
     CollisionLayer collisionLayer;
@@ -49,7 +56,7 @@ private:
     std::shared_ptr<VelocityComponent> velocityComponent;
     utils::Vector2f size;
     utils::DeltaTime currentDeltaTime;
-    std::unordered_map<std::string, Direction> colliderNamesWithDistancesOnXAxis;
+    ColliderContacts contactsOnXAxis;
     ComponentOwner* currentColliderOnXAxis;
 };
 }
\ No newline at end of file
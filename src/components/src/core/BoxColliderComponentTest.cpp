@@ -175,6 +175,36 @@ TEST_F(BoxColliderComponentTest, resolveOverlapWithCollisionFromLeft_shouldBlock
     ASSERT_TRUE(canMoveRight() && canMoveDown() && canMoveUp());
 }
 
+TEST_F(BoxColliderComponentTest, resolveOverlapOnXAxis_shouldRecordContactWithOtherOwner)
+{
+    velocityComponent->setVelocity(-1.f, 0.f);
+    boxColliderComponentWithMovement->update(deltaTime, input);
+    boxColliderComponentWithMovement->setAvailableMovementDirections();
+    boxColliderComponentWithMovement->getNextFrameXCollisionBox();
+
+    boxColliderComponentWithMovement->resolveOverlapX(boxColliderComponentIntersectingFromLeft);
+
+    const auto contact = boxColliderComponentWithMovement->getContactsOnXAxis().getCurrentContact(
+        componentOwnerIntersectingFromLeft.getId());
+    ASSERT_TRUE(contact);
+    ASSERT_EQ(contact->direction, Direction::Left);
+}
+
+TEST_F(BoxColliderComponentTest, setAvailableMovementDirections_shouldEndContactsNotResolvedAgain)
+{
+    velocityComponent->setVelocity(-1.f, 0.f);
+    boxColliderComponentWithMovement->update(deltaTime, input);
+    boxColliderComponentWithMovement->setAvailableMovementDirections();
+    boxColliderComponentWithMovement->getNextFrameXCollisionBox();
+    boxColliderComponentWithMovement->resolveOverlapX(boxColliderComponentIntersectingFromLeft);
+
+    boxColliderComponentWithMovement->setAvailableMovementDirections();
+
+    ASSERT_FALSE(boxColliderComponentWithMovement->getContactsOnXAxis().getCurrentContact(
+        componentOwnerIntersectingFromLeft.getId()));
+    ASSERT_TRUE(canMoveLeft());
+}
+
 TEST_F(BoxColliderComponentTest, resolveOverlapWithCollisionFromRight_shouldBlockRightMovement)
 {
     velocityComponent->setVelocity(1.f, 0.f);
@@ -217,6 +247,24 @@ TEST_F(BoxColliderComponentTest, resolveOverlapWithCollisionFromBelow_shouldBloc
     ASSERT_TRUE(canMoveLeft() && canMoveRight() && canMoveUp());
 }
 
+TEST_F(BoxColliderComponentTest, resolveSweptHitWithNormalPointingLeft_shouldBlockRightMovement)
+{
+    boxColliderComponentWithMovement->resolveSweptHitX(*boxColliderComponentIntersectingFromRight, {-1, 0});
+
+    ASSERT_FALSE(canMoveRight());
+    ASSERT_TRUE(canMoveLeft() && canMoveDown() && canMoveUp());
+    ASSERT_EQ(boxColliderComponentWithMovement->getCurrentColliderOnXAxis(),
+              &boxColliderComponentIntersectingFromRight->getOwner());
+}
+
+TEST_F(BoxColliderComponentTest, resolveSweptHitWithNormalPointingUp_shouldBlockDownMovement)
+{
+    boxColliderComponentWithMovement->resolveSweptHitY({0, -1});
+
+    ASSERT_FALSE(canMoveDown());
+    ASSERT_TRUE(canMoveLeft() && canMoveRight() && canMoveUp());
+}
+
 TEST_F(BoxColliderComponentTest, getSize)
 {
     ASSERT_EQ(boxColliderComponentWithMovement->getSize(), size);
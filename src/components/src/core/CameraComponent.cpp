@@ -16,7 +16,17 @@ components::core::CameraComponent::CameraComponent(components::core::ComponentOw
 
 void components::core::CameraComponent::lateUpdate(utils::DeltaTime, const input::Input&)
 {
-    auto cameraViewCenter = owner->transform->getPosition();
+    centerView(owner->transform->getPosition());
+}
+
+// view follows owner between updates in same way as its graphics, so owner does not jitter on screen
+void components::core::CameraComponent::interpolate(float interpolation)
+{
+    centerView(owner->transform->getInterpolatedPosition(interpolation));
+}
+
+void components::core::CameraComponent::centerView(utils::Vector2f cameraViewCenter)
+{
     auto cameraViewSize = rendererPool->getViewSize();
 
     if (cameraViewCenter.y < mapRect.top + cameraViewSize.y / 2)
@@ -13,8 +13,11 @@ public:
                     utils::FloatRect mapRect, bool blockCameraOnRightSide = true);
 
     void lateUpdate(utils::DeltaTime time, const input::Input& input) override;
+    void interpolate(float interpolation) override;
 
 private:
+    void centerView(utils::Vector2f cameraViewCenter);
+
     std::shared_ptr<graphics::RendererPool> rendererPool;
     utils::FloatRect mapRect;
     const bool blockCameraOnRightSide;
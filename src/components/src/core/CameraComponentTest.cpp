@@ -89,4 +89,25 @@ TEST_F(CameraComponentTest, ownerAtCenterMapBoundary_shouldCenterViewOnOwenr)
     EXPECT_CALL(*rendererPool, setCenter(cameraPositionWhenOwnerAtMapCenter));
 
     componentOwner.lateUpdate(deltaTime, input);
+}
+
+TEST_F(CameraComponentTest, interpolate_shouldCenterViewBetweenPositionsFromBeforeAndAfterUpdate)
+{
+    componentOwner.transform->setPosition(positionAtMapCenter);
+    componentOwner.transform->savePreviousPosition();
+    componentOwner.transform->setPosition(positionAtMapCenter + utils::Vector2f{4, 2});
+
+    EXPECT_CALL(*rendererPool, setCenter(positionAtMapCenter + utils::Vector2f{1, 0.5}));
+
+    componentOwner.interpolate(0.25f);
+}
+
+TEST_F(CameraComponentTest, interpolate_shouldKeepViewInsideMap)
+{
+    componentOwner.transform->setPosition(positionOnLeftMapBoundary);
+    componentOwner.transform->savePreviousPosition();
+
+    EXPECT_CALL(*rendererPool, setCenter(cameraPositionWhenOwnerOnLeftBoundary));
+
+    componentOwner.interpolate(0.5f);
 }
\ No newline at end of file
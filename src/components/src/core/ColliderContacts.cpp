@@ -0,0 +1,57 @@
+#include "ColliderContacts.h"
+
+#include <algorithm>
+
+namespace components::core
+{
+
+void ColliderContacts::startFrame()
+{
+    currentFrame++;
+
+    // contacts from previous frame are kept, so contact continued in this frame keeps its first frame
+    std::erase_if(contacts, [this](const Contact& contact) { return contact.lastFrame + 1 < currentFrame; });
+}
+
+void ColliderContacts::recordContact(unsigned int ownerId, Direction direction)
+{
+    const auto contact = std::find_if(contacts.begin(), contacts.end(), [ownerId](const Contact& contact)
+                                      { return contact.ownerId == ownerId; });
+
+    if (contact == contacts.end())
+    {
+        contacts.push_back({ownerId, direction, currentFrame, currentFrame});
+        return;
+    }
+
+    if (contact->lastFrame + 1 < currentFrame)
+    {
+        contact->firstFrame = currentFrame;
+    }
+
+    contact->direction = direction;
+    contact->lastFrame = currentFrame;
+}
+
+const Contact* ColliderContacts::getCurrentContact(unsigned int ownerId) const
+{
+    const auto contact =
+        std::find_if(contacts.begin(), contacts.end(), [&](const Contact& contact)
+                     { return contact.ownerId == ownerId and contact.lastFrame == currentFrame; });
+
+    return contact != contacts.end() ? &*contact : nullptr;
+}
+
+unsigned int ColliderContacts::getNumberOfFramesInContact(unsigned int ownerId) const
+{
+    const auto contact = getCurrentContact(ownerId);
+
+    return contact ? contact->lastFrame - contact->firstFrame + 1 : 0;
+}
+
+unsigned int ColliderContacts::getCurrentFrame() const
+{
+    return currentFrame;
+}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+namespace components::core
+{
+enum class Direction
+{
+    Left,
+    Right
+};
+
+struct Contact
+{
+    unsigned int ownerId;
+    Direction direction;
+    unsigned int firstFrame;
+    unsigned int lastFrame;
+};
+
+// contacts stay in place between frames, so recording them does not allocate once capacity is reached
+class ColliderContacts
+{
+public:
+    void startFrame();
+    void recordContact(unsigned int ownerId, Direction);
+    const Contact* getCurrentContact(unsigned int ownerId) const;
+    unsigned int getNumberOfFramesInContact(unsigned int ownerId) const;
+    unsigned int getCurrentFrame() const;
+
+private:
+    std::vector<Contact> contacts;
+    unsigned int currentFrame{0};
+};
+}
@@ -0,0 +1,76 @@
+#include "ColliderContacts.h"
+
+#include "gtest/gtest.h"
+
+using namespace components::core;
+using namespace ::testing;
+
+class ColliderContactsTest : public Test
+{
+public:
+    const unsigned int ownerId1{3};
+    const unsigned int ownerId2{7};
+    ColliderContacts contacts;
+};
+
+TEST_F(ColliderContactsTest, givenNoRecordedContacts_shouldNotReturnContact)
+{
+    contacts.startFrame();
+
+    ASSERT_FALSE(contacts.getCurrentContact(ownerId1));
+    ASSERT_EQ(contacts.getNumberOfFramesInContact(ownerId1), 0u);
+}
+
+TEST_F(ColliderContactsTest, recordedContact_shouldBeReturnedWithDirectionAndCurrentFrame)
+{
+    contacts.startFrame();
+
+    contacts.recordContact(ownerId1, Direction::Right);
+
+    const auto contact = contacts.getCurrentContact(ownerId1);
+    ASSERT_TRUE(contact);
+    ASSERT_EQ(contact->direction, Direction::Right);
+    ASSERT_EQ(contact->firstFrame, contacts.getCurrentFrame());
+    ASSERT_EQ(contact->lastFrame, contacts.getCurrentFrame());
+    ASSERT_FALSE(contacts.getCurrentContact(ownerId2));
+}
+
+TEST_F(ColliderContactsTest, contactNotRecordedInNewFrame_shouldNotBeReturned)
+{
+    contacts.startFrame();
+    contacts.recordContact(ownerId1, Direction::Left);
+
+    contacts.startFrame();
+
+    ASSERT_FALSE(contacts.getCurrentContact(ownerId1));
+}
+
+TEST_F(ColliderContactsTest, contactRecordedInConsecutiveFrames_shouldKeepFirstFrame)
+{
+    contacts.startFrame();
+    const auto firstFrame = contacts.getCurrentFrame();
+    contacts.recordContact(ownerId1, Direction::Left);
+    contacts.startFrame();
+    contacts.recordContact(ownerId1, Direction::Left);
+    contacts.startFrame();
+
+    contacts.recordContact(ownerId1, Direction::Right);
+
+    const auto contact = contacts.getCurrentContact(ownerId1);
+    ASSERT_EQ(contact->firstFrame, firstFrame);
+    ASSERT_EQ(contact->direction, Direction::Right);
+    ASSERT_EQ(contacts.getNumberOfFramesInContact(ownerId1), 3u);
+}
+
+TEST_F(ColliderContactsTest, contactRecordedAgainAfterBreak_shouldStartFromNewFrame)
+{
+    contacts.startFrame();
+    contacts.recordContact(ownerId1, Direction::Left);
+    contacts.startFrame();
+    contacts.startFrame();
+
+    contacts.recordContact(ownerId1, Direction::Left);
+
+    ASSERT_EQ(contacts.getCurrentContact(ownerId1)->firstFrame, contacts.getCurrentFrame());
+    ASSERT_EQ(contacts.getNumberOfFramesInContact(ownerId1), 1u);
+}
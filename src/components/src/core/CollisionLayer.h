@@ -23,6 +23,15 @@ inline int toInt(CollisionLayer collisionLayer)
     return collisionLayerToInit.at(collisionLayer);
 }
 
+using CollisionLayerMask = unsigned int;
+
+inline constexpr CollisionLayerMask allCollisionLayers = ~0u;
+
+constexpr CollisionLayerMask toCollisionLayerMask(CollisionLayer collisionLayer)
+{
+    return 1u << static_cast<unsigned int>(collisionLayer);
+}
+
 inline std::string toString(CollisionLayer collisionLayer)
 {
     std::unordered_map<CollisionLayer, std::string> collisionLayerToString{
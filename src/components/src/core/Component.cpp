@@ -12,6 +12,8 @@ void Component::update(utils::DeltaTime, const input::Input&) {}
 
 void Component::lateUpdate(utils::DeltaTime, const input::Input&) {}
 
+void Component::interpolate(float) {}
+
 void Component::enable()
 {
     enabled = true;
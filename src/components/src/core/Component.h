@@ -18,6 +18,7 @@ public:
     virtual void loadDependentComponents();
     virtual void update(utils::DeltaTime, const input::Input&);
     virtual void lateUpdate(utils::DeltaTime, const input::Input& input);
+    virtual void interpolate(float interpolation);
     virtual void enable();
     virtual void disable();
     virtual bool isEnabled() const;
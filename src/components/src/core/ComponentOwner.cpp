@@ -30,6 +30,8 @@ void ComponentOwner::loadDependentComponents()
 
 void ComponentOwner::update(utils::DeltaTime deltaTime, const input::Input& input)
 {
+    transform->savePreviousPosition();
+
     for (int i = static_cast<int>(components.size() - 1); i >= 0; i--)
     {
         components[i]->update(deltaTime, input);
@@ -54,6 +56,19 @@ void ComponentOwner::lateUpdate(utils::DeltaTime deltaTime, const input::Input&
     }
 }
 
+void ComponentOwner::interpolate(float interpolation)
+{
+    for (auto& component : components)
+    {
+        component->interpolate(interpolation);
+    }
+
+    for (auto& graphics : allGraphics)
+    {
+        graphics->interpolatePosition(interpolation);
+    }
+}
+
 void ComponentOwner::enable()
 {
     for (auto& component : components)
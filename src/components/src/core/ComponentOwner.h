@@ -24,6 +24,7 @@ public:
     void loadDependentComponents();
     void update(utils::DeltaTime, const input::Input&);
     void lateUpdate(utils::DeltaTime, const input::Input& input);
+    void interpolate(float interpolation);
     void enable();
     void disable();
     std::string getName() const;
@@ -2,6 +2,7 @@
 
 #include "gtest/gtest.h"
 
+#include "InputMock.h"
 #include "RendererPoolMock.h"
 
 #include "BoxColliderComponent.h"
@@ -168,4 +169,20 @@ TEST_F(ComponentOwnerTest, allAddedGraphicsComponentsShouldBeStored)
     ASSERT_EQ(allGraphicsComponents.at(1).get(), secondGraphicsComponent.get());
     EXPECT_CALL(*rendererPool, release(graphicsId1));
     EXPECT_CALL(*rendererPool, release(graphicsId2));
-}
\ No newline at end of file
+}
+TEST_F(ComponentOwnerTest, interpolate_shouldPlaceGraphicsBetweenPositionsFromBeforeAndAfterUpdate)
+{
+    EXPECT_CALL(*rendererPool,
+                acquire(dummySize, dummyPosition, imagePath, graphics::VisibilityLayer::First, _))
+        .WillOnce(Return(graphicsId1));
+    componentOwner.addGraphicsComponent(rendererPool, dummySize, dummyPosition, imagePath,
+                                        graphics::VisibilityLayer::First, utils::Vector2f{0, 0}, true);
+    const NiceMock<input::InputMock> input;
+    componentOwner.update(utils::DeltaTime{1}, input);
+    componentOwner.transform->setPosition(utils::Vector2f{10.0, 11.0});
+    EXPECT_CALL(*rendererPool, setPosition(graphicsId1, utils::Vector2f{5.0, 11.0}));
+
+    componentOwner.interpolate(0.5f);
+
+    EXPECT_CALL(*rendererPool, release(graphicsId1));
+}
@@ -16,6 +16,7 @@ public:
 
     virtual void add(std::shared_ptr<ComponentOwner>) = 0;
     virtual void update(const utils::DeltaTime&, const input::Input&) = 0;
+    virtual void interpolate(float interpolation) = 0;
     virtual void processNewObjects() = 0;
     virtual void processRemovals() = 0;
     virtual void activate() = 0;
@@ -11,6 +11,7 @@ class ComponentOwnersManagerMock : public ComponentOwnersManager
 public:
     MOCK_METHOD(void, add, (std::shared_ptr<ComponentOwner>), (override));
     MOCK_METHOD(void, update, (const utils::DeltaTime&, const input::Input&), (override));
+    MOCK_METHOD(void, interpolate, (float interpolation), (override));
     MOCK_METHOD(void, processNewObjects, (), (override));
     MOCK_METHOD(void, processRemovals, (), (override));
     MOCK_METHOD(void, activate, (), (override));
@@ -6,8 +6,9 @@ namespace components::core
 {
 
 DefaultComponentOwnersManager::DefaultComponentOwnersManager(
-    std::unique_ptr<physics::CollisionSystem> collisionSystemInit)
-    : collisionSystem{std::move(collisionSystemInit)}
+    std::unique_ptr<physics::CollisionSystem> collisionSystemInit,
+    std::shared_ptr<physics::RayCast> rayCastInit)
+    : collisionSystem{std::move(collisionSystemInit)}, rayCast{std::move(rayCastInit)}
 {
 }
 
@@ -25,6 +26,12 @@ void DefaultComponentOwnersManager::update(const utils::DeltaTime& deltaTime, co
         componentOwner->update(deltaTime, input);
     }
 
+    // rays queued by owners are cast before collisions move anything, as if they were cast one by one
+    if (rayCast)
+    {
+        rayCast->castQueuedRays();
+    }
+
     collisionSystem->update();
 
     for (auto& componentOwner : componentOwners)
@@ -35,6 +42,14 @@ void DefaultComponentOwnersManager::update(const utils::DeltaTime& deltaTime, co
     processRemovals();
 }
 
+void DefaultComponentOwnersManager::interpolate(float interpolation)
+{
+    for (auto& componentOwner : componentOwners)
+    {
+        componentOwner->interpolate(interpolation);
+    }
+}
+
 void DefaultComponentOwnersManager::processNewObjects()
 {
     if (not newComponentOwners.empty())
@@ -2,16 +2,19 @@
 
 #include "CollisionSystem.h"
 #include "ComponentOwnersManager.h"
+#include "RayCast.h"
 
 namespace components::core
 {
 class DefaultComponentOwnersManager : public ComponentOwnersManager
 {
 public:
-    explicit DefaultComponentOwnersManager(std::unique_ptr<physics::CollisionSystem>);
+    explicit DefaultComponentOwnersManager(std::unique_ptr<physics::CollisionSystem>,
+                                           std::shared_ptr<physics::RayCast> = nullptr);
 
     void add(std::shared_ptr<ComponentOwner>) override;
     void update(const utils::DeltaTime&, const input::Input&) override;
+    void interpolate(float interpolation) override;
     void processNewObjects() override;
     void processRemovals() override;
     void activate() override;
@@ -21,5 +24,6 @@ private:
     std::vector<std::shared_ptr<ComponentOwner>> componentOwners;
     std::vector<std::shared_ptr<ComponentOwner>> newComponentOwners;
     std::unique_ptr<physics::CollisionSystem> collisionSystem;
+    std::shared_ptr<physics::RayCast> rayCast;
 };
 }
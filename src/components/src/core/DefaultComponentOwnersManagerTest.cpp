@@ -2,6 +2,7 @@
 
 #include "CollisionSystemMock.h"
 #include "InputMock.h"
+#include "RayCastMock.h"
 #include "RendererPoolMock.h"
 
 using namespace components::core;
@@ -39,6 +40,22 @@ TEST_F(DefaultComponentOwnersManagerTest, update_shouldUpdateCollisions)
     componentOwnersManager.update(deltaTime, input);
 }
 
+TEST_F(DefaultComponentOwnersManagerTest, givenRayCast_update_shouldCastQueuedRaysBeforeUpdatingCollisions)
+{
+    std::unique_ptr<StrictMock<physics::CollisionSystemMock>> collisionSystemWithRayCastInit{
+        std::make_unique<StrictMock<physics::CollisionSystemMock>>()};
+    auto collisionSystemWithRayCast = collisionSystemWithRayCastInit.get();
+    const auto rayCast = std::make_shared<StrictMock<physics::RayCastMock>>();
+    DefaultComponentOwnersManager componentOwnersManagerWithRayCast{std::move(collisionSystemWithRayCastInit),
+                                                                    rayCast};
+    InSequence sequence;
+    EXPECT_CALL(*rayCast, castQueuedRays());
+    EXPECT_CALL(*collisionSystemWithRayCast, update());
+    EXPECT_CALL(*collisionSystemWithRayCast, processRemovals());
+
+    componentOwnersManagerWithRayCast.update(deltaTime, input);
+}
+
 TEST_F(DefaultComponentOwnersManagerTest,
        processNewObjectsWithoutAnyNewObjects_shouldNotAddOwnersInCollisionSystem)
 {
@@ -50,11 +50,26 @@ void GraphicsComponent::lateUpdate(utils::DeltaTime, const input::Input&)
     }
 }
 
+void GraphicsComponent::interpolatePosition(float interpolation)
+{
+    if (enabled and updatesPosition)
+    {
+        rendererPool->setPosition(id, owner->transform->getInterpolatedPosition(interpolation) + offset);
+    }
+}
+
 const graphics::GraphicsId& GraphicsComponent::getGraphicsId()
 {
     return id;
 }
 
+void GraphicsComponent::setStatic()
+{
+    // static graphics is baked by renderer pool, so it no longer follows its owner
+    rendererPool->setStatic(id);
+    updatesPosition = false;
+}
+
 void GraphicsComponent::setColor(const graphics::Color& color)
 {
     rendererPool->setColor(id, color);
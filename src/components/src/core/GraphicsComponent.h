@@ -26,7 +26,9 @@ public:
     ~GraphicsComponent();
 
     void lateUpdate(utils::DeltaTime, const input::Input& input) override;
+    void interpolatePosition(float interpolation);
     const graphics::GraphicsId& getGraphicsId();
+    void setStatic();
     void setColor(const graphics::Color&);
     void setVisibility(graphics::VisibilityLayer);
     void setOutline(float thickness, const sf::Color& color);
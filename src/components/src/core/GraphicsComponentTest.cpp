@@ -114,6 +114,44 @@ TEST_F(GraphicsComponentTest, componentDisabled_lateUpdate_shouldNotSynchronizeP
     expectReleaseGraphicsId();
 }
 
+TEST_F(GraphicsComponentTest, interpolatePosition_shouldSetPositionBetweenPreviousAndCurrentTransformPosition)
+{
+    expectCreateGraphicsComponent();
+    const auto graphicsComponent = createGraphicsComponent();
+    componentOwner.transform->savePreviousPosition();
+    componentOwner.transform->setPosition(position2);
+    EXPECT_CALL(*rendererPool, setPosition(graphicsId, utils::Vector2f{6, 6}));
+
+    graphicsComponent->interpolatePosition(0.5f);
+
+    expectReleaseGraphicsId();
+}
+
+TEST_F(GraphicsComponentTest, componentDisabled_interpolatePosition_shouldNotSetPosition)
+{
+    expectCreateGraphicsComponent();
+    const auto graphicsComponent = createGraphicsComponent();
+    EXPECT_CALL(*rendererPool, setVisibility(graphicsId, invisible));
+    graphicsComponent->disable();
+
+    graphicsComponent->interpolatePosition(0.5f);
+
+    expectReleaseGraphicsId();
+}
+
+TEST_F(GraphicsComponentTest, staticComponent_lateUpdate_shouldNotSynchronizePositionWithTransformComponent)
+{
+    expectCreateGraphicsComponent();
+    const auto graphicsComponent = createGraphicsComponent();
+    EXPECT_CALL(*rendererPool, setStatic(graphicsId));
+    graphicsComponent->setStatic();
+    componentOwner.transform->setPosition(position2);
+
+    graphicsComponent->lateUpdate(deltaTime, input);
+
+    expectReleaseGraphicsId();
+}
+
 TEST_F(GraphicsComponentTest, shouldSetColor)
 {
     expectCreateGraphicsComponent();
@@ -4,7 +4,7 @@ namespace components::core
 {
 
 TransformComponent::TransformComponent(ComponentOwner* ownerInit, const utils::Vector2f& positionInit)
-    : Component{ownerInit}, position{positionInit}
+    : Component{ownerInit}, position{positionInit}, previousPosition{positionInit}
 {
 }
 
@@ -44,4 +44,14 @@ const utils::Vector2f& TransformComponent::getPosition() const
     return position;
 }
 
+void TransformComponent::savePreviousPosition()
+{
+    previousPosition = position;
+}
+
+utils::Vector2f TransformComponent::getInterpolatedPosition(float interpolation) const
+{
+    return previousPosition + (position - previousPosition) * interpolation;
+}
+
 }
\ No newline at end of file
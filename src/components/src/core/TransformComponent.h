@@ -17,8 +17,11 @@ public:
     void setX(float x);
     void setY(float y);
     const utils::Vector2f& getPosition() const;
+    void savePreviousPosition();
+    utils::Vector2f getInterpolatedPosition(float interpolation) const;
 
 private:
     utils::Vector2f position;
+    utils::Vector2f previousPosition;
 };
 }
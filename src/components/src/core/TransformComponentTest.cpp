@@ -75,3 +75,18 @@ TEST_F(TransformComponentTest, setY_shouldSetOnlyYCoordinate)
     ASSERT_EQ(transformComponent.getPosition().y, y);
     ASSERT_EQ(transformComponent.getPosition().x, position1.x);
 }
+
+TEST_F(TransformComponentTest, interpolatedPositionWithoutSavedPreviousPosition_shouldBeEqualToPosition)
+{
+    ASSERT_EQ(transformComponent.getInterpolatedPosition(0.5f), position1);
+}
+
+TEST_F(TransformComponentTest, interpolatedPosition_shouldLieBetweenPreviousAndCurrentPosition)
+{
+    transformComponent.savePreviousPosition();
+    transformComponent.setPosition(position2);
+
+    ASSERT_EQ(transformComponent.getInterpolatedPosition(0.f), position1);
+    ASSERT_EQ(transformComponent.getInterpolatedPosition(0.5f), (utils::Vector2f{6.0, 6.0}));
+    ASSERT_EQ(transformComponent.getInterpolatedPosition(1.f), position2);
+}
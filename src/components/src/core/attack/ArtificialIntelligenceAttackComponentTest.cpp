@@ -48,7 +48,6 @@ public:
     StrictMock<FriendlyFireValidatorMock>* friendlyFireValidator{friendlyFireValidatorInit.get()};
     std::shared_ptr<MeleeAttack> meleeAttack =
         std::make_shared<MeleeAttack>(&componentOwner, rayCast, std::move(friendlyFireValidatorInit));
-    physics::RayCastResult rayCastResult;
 };
 
 TEST_F(ArtificialIntelligenceAttackComponentTest,
@@ -108,7 +107,7 @@ TEST_F(
     EXPECT_CALL(*animator, setAnimation(animations::AnimationType::Attack));
     EXPECT_CALL(*animator, getCurrentAnimationProgressInPercents()).WillOnce(Return(63));
     EXPECT_CALL(*animator, getAnimationDirection()).WillOnce(Return(animations::AnimationDirection::Left));
-    EXPECT_CALL(*rayCast, cast(_, _, _, _)).WillOnce(Return(rayCastResult));
+    EXPECT_CALL(*rayCast, queue(_, _));
 
     attackComponent.update(deltaTime, input);
 }
@@ -27,8 +27,13 @@ void MeleeAttack::attack()
     const auto endPoint =
         utils::Vector2f{startPoint.x + (static_cast<float>(heading.x) * range), startPoint.y};
 
-    const auto result = rayCast->cast(startPoint, endPoint, owner->getId(), 2);
+    // attacks of all owners are cast in one batch after owners are updated
+    rayCast->queue({startPoint, endPoint, owner->getId(), 2},
+                   [this](const physics::RayCastResult& result) { dealDamage(result); });
+}
 
+void MeleeAttack::dealDamage(const physics::RayCastResult& result)
+{
     if (result.collision)
     {
         if (friendlyFireValidator->validate(owner, result.collision) ==
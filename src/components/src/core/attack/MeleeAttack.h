@@ -19,6 +19,7 @@ public:
     void attack();
 
 private:
+    void dealDamage(const physics::RayCastResult&);
     void loadDependentComponents();
 
     ComponentOwner* owner;
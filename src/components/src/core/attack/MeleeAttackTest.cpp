@@ -113,6 +113,7 @@ TEST_F(MeleeAttackTest, givenTargetInAttackRangeOnRight_shouldDealDamageToTarget
                 validate(&boxColliderComponent1->getOwner(), &boxColliderComponentOnRightInRange->getOwner()))
         .WillOnce(Return(FriendlyFireValidationResult::AttackAllowed));
     meleeAttack.attack();
+    rayCast->castQueuedRays();
 
     ASSERT_EQ(targetHealthComponentOnRightInRange->getCurrentHealth(), 90);
 }
@@ -128,6 +129,7 @@ TEST_F(MeleeAttackTest,
         .WillOnce(Return(FriendlyFireValidationResult::AttackNotAllowed));
 
     meleeAttack.attack();
+    rayCast->castQueuedRays();
 
     ASSERT_EQ(targetHealthComponentOnRightInRange->getCurrentHealth(), 100);
 }
@@ -139,6 +141,7 @@ TEST_F(MeleeAttackTest, givenTargetOutOfAttackRangeOnRight_shouldNotDealAnyDamag
     EXPECT_CALL(*animator, getAnimationDirection()).WillOnce(Return(animations::AnimationDirection::Right));
 
     meleeAttack.attack();
+    rayCast->castQueuedRays();
 
     ASSERT_EQ(targetHealthComponentOnRightOutOfRange->getCurrentHealth(), 100);
 }
@@ -153,6 +156,7 @@ TEST_F(MeleeAttackTest, givenTargetInAttackRangeOnLeft_shouldDealDamageToTarget)
         .WillOnce(Return(FriendlyFireValidationResult::AttackAllowed));
 
     meleeAttack.attack();
+    rayCast->castQueuedRays();
 
     ASSERT_EQ(targetHealthComponentOnLeftInRange->getCurrentHealth(), 90);
 }
@@ -168,6 +172,7 @@ TEST_F(MeleeAttackTest,
         .WillOnce(Return(FriendlyFireValidationResult::AttackNotAllowed));
 
     meleeAttack.attack();
+    rayCast->castQueuedRays();
 
     ASSERT_EQ(targetHealthComponentOnLeftInRange->getCurrentHealth(), 100);
 }
@@ -179,6 +184,7 @@ TEST_F(MeleeAttackTest, givenTargetOutOfAttackRangeOnLeft_shouldNotDealAnyDamage
     EXPECT_CALL(*animator, getAnimationDirection()).WillOnce(Return(animations::AnimationDirection::Left));
 
     meleeAttack.attack();
+    rayCast->castQueuedRays();
 
     ASSERT_EQ(targetHealthComponentOnLeftOutOfRange->getCurrentHealth(), 100);
 }
@@ -158,12 +158,13 @@ std::shared_ptr<CollectableItemComponent> ItemCollectorComponent::findNearestIte
                                             ownerPosition.y + (ownerSize.y / 2.f) - 5.f};
     const auto searchSize = utils::Vector2f{10.f, 10.f};
     const auto collisionArea = utils::FloatRect{startPoint, searchSize};
-    const auto colliders = collisions->getCollidersIntersectingWithAreaFromX(collisionArea);
+    collidersNearOwner.clear();
+    collisions->getCollidersIntersectingWithAreaFromX(collisionArea, collidersNearOwner);
 
     std::shared_ptr<components::core::CollectableItemComponent> closestItem;
     double closestDistance = 1000.0;
 
-    for (const auto& collider : colliders)
+    for (const auto collider : collidersNearOwner)
     {
         const auto itemCollider = collider->getOwner().getComponent<CollectableItemComponent>();
         if (not itemCollider)
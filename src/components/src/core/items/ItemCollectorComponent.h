@@ -41,5 +41,6 @@ private:
     const float dropRange{4};
     const float timeAfterNextItemCanBeCollected;
     std::shared_ptr<utils::Timer> possibilityToCollectNextItemTimer;
+    mutable std::vector<BoxColliderComponent*> collidersNearOwner;
 };
 }
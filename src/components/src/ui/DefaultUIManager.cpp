@@ -84,6 +84,9 @@ void DefaultUIManager::createUI(std::unique_ptr<UIConfig> uiConfig)
     }
 
     createUIComponents(std::move(uiConfig));
+
+    // textures of ui are uploaded before its first frame
+    sharedContext->rendererPool->waitForTextures();
 }
 
 void DefaultUIManager::update(utils::DeltaTime deltaTime, const input::Input& input)
@@ -156,6 +156,13 @@ TEST_F(DefaultUIManagerTest, createUIWithValidUIConfig_shouldNoThrow)
     ASSERT_NO_THROW(uiManager.createUI(createUIConfig()));
 }
 
+TEST_F(DefaultUIManagerTest, createUI_shouldWaitForTexturesOfCreatedComponents)
+{
+    EXPECT_CALL(*rendererPool, waitForTextures());
+
+    uiManager.createUI(createUIConfig());
+}
+
 TEST_F(DefaultUIManagerTest, activate_shouldActivateAllComponents_exceptButtonAndCheckBox)
 {
     uiManager.createUI(createUIConfig());
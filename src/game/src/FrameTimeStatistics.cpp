@@ -0,0 +1,36 @@
+#include "FrameTimeStatistics.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace game
+{
+
+FrameTimeStatistics calculateFrameTimeStatistics(std::vector<utils::DeltaTime> frameTimes)
+{
+    if (frameTimes.empty())
+    {
+        return {0, {}, {}, {}, {}};
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+
+    const auto numberOfFrames = frameTimes.size();
+    const auto sum = std::accumulate(frameTimes.begin(), frameTimes.end(), utils::DeltaTime{0});
+    const auto ninetyFifthPercentileIndex = (numberOfFrames * 95 + 99) / 100 - 1;
+
+    return {numberOfFrames, sum / static_cast<float>(numberOfFrames), frameTimes[(numberOfFrames - 1) / 2],
+            frameTimes[ninetyFifthPercentileIndex], frameTimes.back()};
+}
+
+std::ostream& operator<<(std::ostream& os, const FrameTimeStatistics& statistics)
+{
+    const auto toMilliseconds = [](const utils::DeltaTime& time) { return time.count() * 1000; };
+
+    return os << "frames: " << statistics.numberOfFrames << ", mean: " << toMilliseconds(statistics.mean)
+              << " ms, median: " << toMilliseconds(statistics.median)
+              << " ms, 95th percentile: " << toMilliseconds(statistics.ninetyFifthPercentile)
+              << " ms, max: " << toMilliseconds(statistics.max) << " ms";
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+#include "DeltaTime.h"
+
+namespace game
+{
+struct FrameTimeStatistics
+{
+    std::size_t numberOfFrames;
+    utils::DeltaTime mean;
+    utils::DeltaTime median;
+    utils::DeltaTime ninetyFifthPercentile;
+    utils::DeltaTime max;
+};
+
+FrameTimeStatistics calculateFrameTimeStatistics(std::vector<utils::DeltaTime> frameTimes);
+
+std::ostream& operator<<(std::ostream& os, const FrameTimeStatistics&);
+}
@@ -0,0 +1,51 @@
+#include "FrameTimeStatistics.h"
+
+#include "gtest/gtest.h"
+
+using namespace game;
+using namespace ::testing;
+
+class FrameTimeStatisticsTest : public Test
+{
+public:
+    std::vector<utils::DeltaTime> createFrameTimes(int numberOfFrames)
+    {
+        std::vector<utils::DeltaTime> frameTimes;
+
+        for (int frame = numberOfFrames; frame > 0; frame--)
+        {
+            frameTimes.push_back(utils::DeltaTime{static_cast<float>(frame)});
+        }
+
+        return frameTimes;
+    }
+};
+
+TEST_F(FrameTimeStatisticsTest, givenNoFrames_shouldReturnZeroedStatistics)
+{
+    const auto statistics = calculateFrameTimeStatistics({});
+
+    ASSERT_EQ(statistics.numberOfFrames, 0u);
+    ASSERT_EQ(statistics.max, utils::DeltaTime{0});
+}
+
+TEST_F(FrameTimeStatisticsTest, givenUnsortedFrameTimes_shouldCalculateStatistics)
+{
+    const auto statistics = calculateFrameTimeStatistics(createFrameTimes(100));
+
+    ASSERT_EQ(statistics.numberOfFrames, 100u);
+    ASSERT_FLOAT_EQ(statistics.mean.count(), 50.5f);
+    ASSERT_FLOAT_EQ(statistics.median.count(), 50.f);
+    ASSERT_FLOAT_EQ(statistics.ninetyFifthPercentile.count(), 95.f);
+    ASSERT_FLOAT_EQ(statistics.max.count(), 100.f);
+}
+
+TEST_F(FrameTimeStatisticsTest, givenSingleFrame_allStatisticsShouldBeEqualToItsTime)
+{
+    const auto statistics = calculateFrameTimeStatistics(createFrameTimes(1));
+
+    ASSERT_FLOAT_EQ(statistics.mean.count(), 1.f);
+    ASSERT_FLOAT_EQ(statistics.median.count(), 1.f);
+    ASSERT_FLOAT_EQ(statistics.ninetyFifthPercentile.count(), 1.f);
+    ASSERT_FLOAT_EQ(statistics.max.count(), 1.f);
+}
@@ -1,5 +1,6 @@
 #include "Game.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -7,8 +8,12 @@ namespace game
 {
 
 Game::Game(std::shared_ptr<window::Window> windowInit, std::shared_ptr<input::InputManager> inputManagerInit,
-           std::unique_ptr<States> statesInit)
-    : window{std::move(windowInit)}, inputManager{std::move(inputManagerInit)}, states{std::move(statesInit)}
+           std::unique_ptr<States> statesInit, const GameLoopSettings& settingsInit)
+    : settings{settingsInit},
+      accumulatedTime{0},
+      window{std::move(windowInit)},
+      inputManager{std::move(inputManagerInit)},
+      states{std::move(statesInit)}
 {
     states->addNextState(StateType::Menu);
 }
@@ -20,7 +25,8 @@ void Game::run()
         while (window->isOpen())
         {
             std::this_thread::sleep_for(std::chrono::duration<double, std::nano>(1));
-            if (const auto gameState = update(); gameState == StatesStatus::Exit)
+            const auto gameState = settings.fixedTimestep ? updateWithFixedTimestep() : update();
+            if (gameState == StatesStatus::Exit)
             {
                 window->close();
                 break;
@@ -35,14 +41,78 @@ void Game::run()
     }
 }
 
+void Game::startRecording(std::unique_ptr<input::InputRecorder> inputRecorderInit)
+{
+    inputRecorder = std::move(inputRecorderInit);
+}
+
+FrameTimeStatistics Game::replay(input::ReplayInputManager& replayInputManager, utils::SimulationClock& clock)
+{
+    std::vector<utils::DeltaTime> frameTimes;
+
+    // rendering is skipped, only simulation is measured
+    while (replayInputManager.hasNextFrame())
+    {
+        const auto& input = replayInputManager.readInput();
+        const auto deltaTime = replayInputManager.getDeltaTime();
+        clock.advance(deltaTime);
+
+        const auto frameStart = std::chrono::steady_clock::now();
+        const auto statesStatus = states->updateCurrentState(deltaTime, input);
+        frameTimes.push_back(std::chrono::steady_clock::now() - frameStart);
+
+        if (statesStatus == StatesStatus::Exit)
+        {
+            break;
+        }
+    }
+
+    return calculateFrameTimeStatistics(std::move(frameTimes));
+}
+
 StatesStatus Game::update()
 {
     const auto deltaTime = timer.getDurationFromLastUpdate();
     const auto& input = inputManager->readInput();
+
+    if (inputRecorder)
+    {
+        inputRecorder->record(input, deltaTime);
+    }
+
     const auto statesStatus = states->updateCurrentState(deltaTime, input);
     return statesStatus;
 }
 
+StatesStatus Game::updateWithFixedTimestep()
+{
+    accumulatedTime += timer.getDurationFromLastUpdate();
+
+    for (int step = 0; step < settings.maxNumberOfStepsPerFrame and accumulatedTime >= settings.timestep;
+         step++)
+    {
+        const auto& input = inputManager->readInput();
+
+        if (inputRecorder)
+        {
+            inputRecorder->record(input, settings.timestep);
+        }
+
+        if (states->updateCurrentState(settings.timestep, input) == StatesStatus::Exit)
+        {
+            return StatesStatus::Exit;
+        }
+
+        accumulatedTime -= settings.timestep;
+    }
+
+    // simulation running behind after all allowed steps drops the remaining time instead of spiralling
+    accumulatedTime = std::min(accumulatedTime, settings.timestep);
+
+    states->interpolateCurrentState(accumulatedTime / settings.timestep);
+    return StatesStatus::Running;
+}
+
 void Game::render()
 {
     states->render();
@@ -2,9 +2,14 @@
 
 #include <memory>
 
+#include "FrameTimeStatistics.h"
+#include "GameLoopSettings.h"
 #include "GameTimer.h"
 #include "InputManager.h"
+#include "InputRecorder.h"
 #include "RendererPool.h"
+#include "ReplayInputManager.h"
+#include "SimulationClock.h"
 #include "State.h"
 #include "States.h"
 #include "TileMap.h"
@@ -16,17 +21,23 @@ class Game
 {
 public:
     explicit Game(std::shared_ptr<window::Window> window, std::shared_ptr<input::InputManager> inputManager,
-                  std::unique_ptr<States> states);
+                  std::unique_ptr<States> states, const GameLoopSettings& = {});
 
     void run();
+    void startRecording(std::unique_ptr<input::InputRecorder>);
+    FrameTimeStatistics replay(input::ReplayInputManager&, utils::SimulationClock&);
 
 private:
     StatesStatus update();
+    StatesStatus updateWithFixedTimestep();
     void render();
 
     GameTimer timer;
+    const GameLoopSettings settings;
+    utils::DeltaTime accumulatedTime;
     std::shared_ptr<window::Window> window;
     std::shared_ptr<input::InputManager> inputManager;
     std::unique_ptr<States> states;
+    std::unique_ptr<input::InputRecorder> inputRecorder;
 };
 }
\ No newline at end of file
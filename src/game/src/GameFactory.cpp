@@ -18,20 +18,34 @@ const int tileSizeY = 4;
 const auto windowSize = utils::Vector2u{800, 600};
 const auto mapSize = utils::Vector2u{80u, 60u};
 const auto gameTitle = "chimarrao-platformer";
+const auto gameLoopSettings = GameLoopSettings{true, utils::DeltaTime{1.f / 120.f}, 5};
 }
 
 std::unique_ptr<Game> GameFactory::createGame()
 {
     const auto graphicsFactory = graphics::GraphicsFactory::createGraphicsFactory();
     const auto windowFactory = window::WindowFactory::createWindowFactory();
-    const auto inputManagerFactory = input::InputManagerFactory::createInputManagerFactory();
-    const auto fileAccessFactory = utils::FileAccessFactory::createFileAccessFactory();
-    const auto audioFactory = audio::AudioFactory::createAudioFactory();
 
     std::shared_ptr<window::Window> window = windowFactory->createWindow(windowSize, gameTitle);
 
-    std::shared_ptr<graphics::RendererPool> rendererPool =
-        graphicsFactory->createRendererPool(window, windowSize, mapSize);
+    return createGame(window, graphicsFactory->createRendererPool(window, windowSize, mapSize));
+}
+
+std::unique_ptr<Game> GameFactory::createHeadlessGame()
+{
+    const auto graphicsFactory = graphics::GraphicsFactory::createGraphicsFactory();
+    const auto windowFactory = window::WindowFactory::createWindowFactory();
+
+    return createGame(windowFactory->createHeadlessWindow(windowSize),
+                      graphicsFactory->createHeadlessRendererPool(windowSize, mapSize));
+}
+
+std::unique_ptr<Game> GameFactory::createGame(std::shared_ptr<window::Window> window,
+                                              std::shared_ptr<graphics::RendererPool> rendererPool)
+{
+    const auto inputManagerFactory = input::InputManagerFactory::createInputManagerFactory();
+    const auto fileAccessFactory = utils::FileAccessFactory::createFileAccessFactory();
+    const auto audioFactory = audio::AudioFactory::createAudioFactory();
 
     std::shared_ptr<input::InputManager> inputManager = inputManagerFactory->createInputManager(window);
 
@@ -46,6 +60,6 @@ std::unique_ptr<Game> GameFactory::createGame()
 
     auto states = std::make_unique<DefaultStates>(window, rendererPool, fileAccess, tileMap, musicManager);
 
-    return std::make_unique<Game>(window, inputManager, std::move(states));
+    return std::make_unique<Game>(window, inputManager, std::move(states), gameLoopSettings);
 }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Game.h"
+#include "RendererPool.h"
+#include "Window.h"
 
 namespace game
 {
@@ -8,5 +10,11 @@ class GameFactory
 {
 public:
     static std::unique_ptr<Game> createGame();
+    // game without window and graphics context, for replaying recorded input where there is no display
+    static std::unique_ptr<Game> createHeadlessGame();
+
+private:
+    static std::unique_ptr<Game> createGame(std::shared_ptr<window::Window>,
+                                            std::shared_ptr<graphics::RendererPool>);
 };
 }
\ No newline at end of file
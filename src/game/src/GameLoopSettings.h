@@ -0,0 +1,13 @@
+#pragma once
+
+#include "DeltaTime.h"
+
+namespace game
+{
+struct GameLoopSettings
+{
+    bool fixedTimestep{false};
+    utils::DeltaTime timestep{1.f / 120.f};
+    int maxNumberOfStepsPerFrame{5};
+};
+}
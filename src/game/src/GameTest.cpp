@@ -1,9 +1,13 @@
 #include "Game.h"
 
+#include <sstream>
+
 #include "gtest/gtest.h"
 
 #include "InputManagerMock.h"
 #include "InputMock.h"
+#include "InputRecordingReader.h"
+#include "InputSfml.h"
 #include "StatesMock.h"
 #include "WindowMock.h"
 
@@ -33,6 +37,14 @@ public:
     Game game{window, inputManager, std::move(statesInit)};
 };
 
+class GameWithFixedTimestepTest : public GameTest_Base
+{
+public:
+    const int maxNumberOfStepsPerFrame{3};
+    const utils::DeltaTime tinyTimestep{1e-9f};
+    const utils::DeltaTime hugeTimestep{3600.f};
+};
+
 TEST_F(GameTest, run_withWindowClosed)
 {
     EXPECT_CALL(*window, isOpen()).WillOnce(Return(true)).WillOnce(Return(false));
@@ -53,4 +65,91 @@ TEST_F(GameTest, run_withExitFromStates)
     EXPECT_CALL(*window, close());
 
     game.run();
-}
\ No newline at end of file
+}
+
+TEST_F(GameWithFixedTimestepTest, run_withSimulationBehind_shouldCapNumberOfStepsAndRenderLatestState)
+{
+    Game game{window, inputManager, std::move(statesInit), {true, tinyTimestep, maxNumberOfStepsPerFrame}};
+    EXPECT_CALL(*window, isOpen()).WillOnce(Return(true)).WillOnce(Return(false));
+    EXPECT_CALL(*inputManager, readInput()).Times(maxNumberOfStepsPerFrame).WillRepeatedly(ReturnRef(input));
+    EXPECT_CALL(*states, updateCurrentState(tinyTimestep, Ref(input)))
+        .Times(maxNumberOfStepsPerFrame)
+        .WillRepeatedly(Return(StatesStatus::Running));
+    EXPECT_CALL(*states, interpolateCurrentState(FloatEq(1.f)));
+    EXPECT_CALL(*states, render());
+    EXPECT_CALL(*window, update());
+    EXPECT_CALL(*window, display());
+
+    game.run();
+}
+
+TEST_F(GameWithFixedTimestepTest, run_withLessTimeThanTimestep_shouldOnlyRender)
+{
+    Game game{window, inputManager, std::move(statesInit), {true, hugeTimestep, maxNumberOfStepsPerFrame}};
+    EXPECT_CALL(*window, isOpen()).WillOnce(Return(true)).WillOnce(Return(false));
+    EXPECT_CALL(*states, interpolateCurrentState(FloatNear(0.f, 0.01f)));
+    EXPECT_CALL(*states, render());
+    EXPECT_CALL(*window, update());
+    EXPECT_CALL(*window, display());
+
+    game.run();
+}
+
+TEST_F(GameWithFixedTimestepTest, run_withExitFromStates_shouldStopRemainingSteps)
+{
+    Game game{window, inputManager, std::move(statesInit), {true, tinyTimestep, maxNumberOfStepsPerFrame}};
+    EXPECT_CALL(*window, isOpen()).WillOnce(Return(true));
+    EXPECT_CALL(*inputManager, readInput()).WillOnce(ReturnRef(input));
+    EXPECT_CALL(*states, updateCurrentState(tinyTimestep, Ref(input))).WillOnce(Return(StatesStatus::Exit));
+    EXPECT_CALL(*window, close());
+
+    game.run();
+}
+
+TEST_F(GameTest, run_withRecording_shouldRecordReadInput)
+{
+    auto recordingInit = std::make_unique<std::stringstream>();
+    auto recording = recordingInit.get();
+    game.startRecording(std::make_unique<input::InputRecorder>(std::move(recordingInit)));
+    NiceMock<input::InputMock> recordedInput;
+    ON_CALL(recordedInput, isKeyPressed(input::InputKey::Space)).WillByDefault(Return(true));
+    EXPECT_CALL(*window, isOpen()).WillOnce(Return(true));
+    EXPECT_CALL(*inputManager, readInput()).WillOnce(ReturnRef(recordedInput));
+    EXPECT_CALL(*states, updateCurrentState(_, Ref(recordedInput))).WillOnce(Return(StatesStatus::Exit));
+    EXPECT_CALL(*window, close());
+
+    game.run();
+
+    const auto frames = input::InputRecordingReader::read(*recording);
+    ASSERT_EQ(frames.size(), 1u);
+    ASSERT_EQ(frames[0].pressedKeys, std::uint64_t{1} << static_cast<unsigned>(input::InputKey::Space));
+}
+
+TEST_F(GameTest, replay_shouldUpdateStatesWithRecordedFramesAndAdvanceClock)
+{
+    const utils::DeltaTime deltaTime{0.25f};
+    input::ReplayInputManager replayInputManager{std::make_unique<input::InputSfml>(),
+                                                 {{deltaTime, 0, {}, {}}, {deltaTime, 0, {}, {}}}};
+    utils::SimulationClock clock;
+    EXPECT_CALL(*states, updateCurrentState(deltaTime, _))
+        .Times(2)
+        .WillRepeatedly(Return(StatesStatus::Running));
+
+    const auto statistics = game.replay(replayInputManager, clock);
+
+    ASSERT_EQ(statistics.numberOfFrames, 2u);
+    ASSERT_FLOAT_EQ(clock.getElapsedSeconds(), 0.5f);
+}
+
+TEST_F(GameTest, replay_withExitFromStates_shouldStopReplay)
+{
+    const utils::DeltaTime deltaTime{0.25f};
+    input::ReplayInputManager replayInputManager{std::make_unique<input::InputSfml>(),
+                                                 {{deltaTime, 0, {}, {}}, {deltaTime, 0, {}, {}}}};
+    utils::SimulationClock clock;
+    EXPECT_CALL(*states, updateCurrentState(deltaTime, _)).WillOnce(Return(StatesStatus::Exit));
+
+    const auto statistics = game.replay(replayInputManager, clock);
+
+    ASSERT_EQ(statistics.numberOfFrames, 1u);
+}
@@ -54,6 +54,14 @@ void DefaultStates::addNextState(StateType stateType)
     states.push(stateFactory->createState(stateType));
 }
 
+void DefaultStates::interpolateCurrentState(float interpolation)
+{
+    if (not states.empty())
+    {
+        states.top()->interpolate(interpolation);
+    }
+}
+
 void DefaultStates::render()
 {
     if (not states.empty())
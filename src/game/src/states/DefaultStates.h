@@ -21,6 +21,7 @@ public:
     StatesStatus updateCurrentState(const utils::DeltaTime&, const input::Input&) override;
     void deactivateCurrentState() override;
     void addNextState(StateType) override;
+    void interpolateCurrentState(float interpolation) override;
     void render() override;
 
 private:
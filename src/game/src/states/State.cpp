@@ -22,6 +22,8 @@ State::~State()
     window->removeObserver(this);
 }
 
+void State::interpolate(float) {}
+
 void State::handleWindowSizeChange(const utils::Vector2u& windowSize)
 {
     rendererPool->setRenderingSize(windowSize);
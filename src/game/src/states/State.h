@@ -29,6 +29,7 @@ public:
 
     virtual NextState update(const utils::DeltaTime&, const input::Input&) = 0;
     virtual void lateUpdate(const utils::DeltaTime&, const input::Input&) = 0;
+    virtual void interpolate(float interpolation);
     virtual void render() = 0;
     virtual StateType getType() const = 0;
     virtual void activate() = 0;
@@ -15,6 +15,7 @@ public:
     virtual StatesStatus updateCurrentState(const utils::DeltaTime&, const input::Input&) = 0;
     virtual void deactivateCurrentState() = 0;
     virtual void addNextState(StateType) = 0;
+    virtual void interpolateCurrentState(float interpolation) = 0;
     virtual void render() = 0;
 };
 }
\ No newline at end of file
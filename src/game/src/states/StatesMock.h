@@ -12,6 +12,7 @@ public:
     MOCK_METHOD(StatesStatus, updateCurrentState, (const utils::DeltaTime&, const input::Input&), (override));
     MOCK_METHOD(void, deactivateCurrentState, (), (override));
     MOCK_METHOD(void, addNextState, (StateType), (override));
+    MOCK_METHOD(void, interpolateCurrentState, (float interpolation), (override));
     MOCK_METHOD(void, render, (), (override));
 };
 }
\ No newline at end of file
@@ -34,12 +34,12 @@ CustomGameState::CustomGameState(const std::shared_ptr<window::Window>& windowIn
       tileMap{std::move(tileMapInit)},
       sharedContext{sharedContextInit},
       musicManager{std::move(musicManagerInit)},
+      rayCast{physicsFactory->createRayCast()},
       ownersManager{std::make_shared<components::core::DefaultComponentOwnersManager>(
-          physicsFactory->createCollisionSystem())}
+          physicsFactory->createCollisionSystem(), rayCast)}
 {
     uiManager->createUI(GameStateUIConfigBuilder::createGameUIConfig());
 
-    auto rayCast = physicsFactory->createRayCast();
     auto quadTree = physicsFactory->getQuadTree();
     auto characterFactory = std::make_shared<CharacterFactory>(sharedContext, tileMap, rayCast, quadTree);
     auto obstacleFactory = std::make_shared<ObstacleFactory>(sharedContext);
@@ -85,6 +85,11 @@ NextState CustomGameState::update(const utils::DeltaTime& deltaTime, const input
 
 void CustomGameState::lateUpdate(const utils::DeltaTime&, const input::Input&) {}
 
+void CustomGameState::interpolate(float interpolation)
+{
+    ownersManager->interpolate(interpolation);
+}
+
 void CustomGameState::render()
 {
     rendererPool->renderAll();
@@ -31,6 +31,7 @@ public:
 
     NextState update(const utils::DeltaTime&, const input::Input&) override;
     void lateUpdate(const utils::DeltaTime&, const input::Input&) override;
+    void interpolate(float interpolation) override;
     void render() override;
     StateType getType() const override;
     void activate() override;
@@ -48,6 +49,7 @@ private:
     const std::shared_ptr<components::core::SharedContext>& sharedContext;
     std::shared_ptr<audio::MusicManager> musicManager;
     audio::MusicId musicId;
+    std::shared_ptr<physics::RayCast> rayCast;
     std::shared_ptr<components::core::ComponentOwnersManager> ownersManager;
 };
 }
\ No newline at end of file
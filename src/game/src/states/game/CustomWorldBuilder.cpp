@@ -145,6 +145,9 @@ CustomWorldBuilder::buildWorldObjects(const std::shared_ptr<TileMap>& tileMap)
         components::core::CollisionLayer::Default);
     worldObjects.push_back(bottomMapBorder);
 
+    // textures of map are uploaded before its first frame
+    sharedContext->rendererPool->waitForTextures();
+
     return worldObjects;
 }
 
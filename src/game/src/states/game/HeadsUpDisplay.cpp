@@ -40,6 +40,7 @@ HeadsUpDisplay::HeadsUpDisplay(std::shared_ptr<components::core::ComponentOwner>
     }
 
     createUIComponents(std::move(uiConfig));
+    sharedContext->rendererPool->waitForTextures();
     auto& healthBarFrame = images[HeadsUpDisplayUIConfigBuilder::getHealthBarFrameId()];
     healthBarFrame->setOutline(0.15, graphics::Color::Black);
 
@@ -77,6 +77,7 @@ public:
         EXPECT_CALL(*rendererPool, acquireText(slotsLabelPosition, "ITEMS", fontPath, characterSize,
                                                graphics::VisibilityLayer::First, graphics::Color::Black, _))
             .WillOnce(Return(graphicsId4));
+        EXPECT_CALL(*rendererPool, waitForTextures());
     }
 
     void expectReleaseGraphicsIds()
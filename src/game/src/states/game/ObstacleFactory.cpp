@@ -26,7 +26,8 @@ ObstacleFactory::createBrick(const utils::Vector2f& position)
     auto brick = std::make_shared<components::core::ComponentOwner>(
         position, "brick" + std::to_string(numberOfBricksInGame), sharedContext);
     brick->addGraphicsComponent(sharedContext->rendererPool, utils::Vector2f{4, 4}, position,
-                                tileTypeToPathTexture(TileType::Brick), graphics::VisibilityLayer::Second);
+                                tileTypeToPathTexture(TileType::Brick), graphics::VisibilityLayer::Second)
+        ->setStatic();
     brick->addComponent<components::core::BoxColliderComponent>(utils::Vector2f{4, 4},
                                                                 components::core::CollisionLayer::Tile);
     return brick;
@@ -40,7 +41,8 @@ ObstacleFactory::createGrass(const utils::Vector2f& position)
     auto grass = std::make_shared<components::core::ComponentOwner>(
         position, "grass" + std::to_string(numberOfGrassesInGame), sharedContext);
     grass->addGraphicsComponent(sharedContext->rendererPool, utils::Vector2f{4, 4}, position,
-                                tileTypeToPathTexture(TileType::Grass), graphics::VisibilityLayer::Second);
+                                tileTypeToPathTexture(TileType::Grass), graphics::VisibilityLayer::Second)
+        ->setStatic();
     grass->addComponent<components::core::BoxColliderComponent>(utils::Vector2f{4, 4},
                                                                 components::core::CollisionLayer::Tile);
     return grass;
@@ -53,7 +55,8 @@ std::shared_ptr<components::core::ComponentOwner> ObstacleFactory::createSoil(co
     auto soil = std::make_shared<components::core::ComponentOwner>(
         position, "soil" + std::to_string(numberOfSoilsInGame), sharedContext);
     soil->addGraphicsComponent(sharedContext->rendererPool, utils::Vector2f{4, 4}, position,
-                               tileTypeToPathTexture(TileType::Soil), graphics::VisibilityLayer::Second);
+                               tileTypeToPathTexture(TileType::Soil), graphics::VisibilityLayer::Second)
+        ->setStatic();
     soil->addComponent<components::core::BoxColliderComponent>(utils::Vector2f{4, 4},
                                                                components::core::CollisionLayer::Tile);
     return soil;
@@ -66,7 +69,8 @@ std::shared_ptr<components::core::ComponentOwner> ObstacleFactory::createTree(co
     auto tree = std::make_shared<components::core::ComponentOwner>(
         position, "tree" + std::to_string(numberOfTreesInGame), sharedContext);
     tree->addGraphicsComponent(sharedContext->rendererPool, utils::Vector2f{4, 4}, position,
-                               tileTypeToPathTexture(TileType::Tree), graphics::VisibilityLayer::Second);
+                               tileTypeToPathTexture(TileType::Tree), graphics::VisibilityLayer::Second)
+        ->setStatic();
     tree->addComponent<components::core::BoxColliderComponent>(utils::Vector2f{4, 4},
                                                                components::core::CollisionLayer::Tile);
     return tree;
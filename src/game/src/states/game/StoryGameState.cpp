@@ -38,9 +38,9 @@ StoryGameState::StoryGameState(const std::shared_ptr<window::Window>& windowInit
 {
     uiManager->createUI(GameStateUIConfigBuilder::createGameUIConfig());
 
-    auto ownersManager = std::make_shared<components::core::DefaultComponentOwnersManager>(
-        physicsFactory->createCollisionSystem());
     auto rayCast = physicsFactory->createRayCast();
+    auto ownersManager = std::make_shared<components::core::DefaultComponentOwnersManager>(
+        physicsFactory->createCollisionSystem(), rayCast);
     auto quadTree = physicsFactory->getQuadTree();
     auto characterFactory = std::make_shared<CharacterFactory>(sharedContext, tileMap, rayCast, quadTree);
     auto obstacleFactory = std::make_shared<ObstacleFactory>(sharedContext);
@@ -84,6 +84,11 @@ NextState StoryGameState::update(const utils::DeltaTime& deltaTime, const input:
 
 void StoryGameState::lateUpdate(const utils::DeltaTime&, const input::Input&) {}
 
+void StoryGameState::interpolate(float interpolation)
+{
+    levelControllers.front()->interpolate(interpolation);
+}
+
 void StoryGameState::render()
 {
     rendererPool->renderAll();
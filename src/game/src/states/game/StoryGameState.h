@@ -35,6 +35,7 @@ public:
 
     NextState update(const utils::DeltaTime&, const input::Input&) override;
     void lateUpdate(const utils::DeltaTime&, const input::Input&) override;
+    void interpolate(float interpolation) override;
     void render() override;
     StateType getType() const override;
     void activate() override;
@@ -142,6 +142,11 @@ SwitchToNextLevel Level1Controller::update(const utils::DeltaTime& deltaTime, co
     return false;
 }
 
+void Level1Controller::interpolate(float interpolation)
+{
+    ownersManager->interpolate(interpolation);
+}
+
 void Level1Controller::activate()
 {
     ownersManager->activate();
@@ -28,6 +28,7 @@ public:
                      StoryGameState*);
 
     SwitchToNextLevel update(const utils::DeltaTime& deltaTime, const input::Input& input) override;
+    void interpolate(float interpolation) override;
     void activate() override;
     void deactivate() override;
     Level1MainCharacters getCharacters() const;
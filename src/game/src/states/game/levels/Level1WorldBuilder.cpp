@@ -207,6 +207,9 @@ Level1WorldBuilder::buildWorldObjects(const std::shared_ptr<TileMap>& tileMap)
         components::core::CollisionLayer::Default);
     worldObjects.push_back(bottomMapBorder);
 
+    // textures of level are uploaded before its first frame
+    sharedContext->rendererPool->waitForTextures();
+
     return worldObjects;
 }
 
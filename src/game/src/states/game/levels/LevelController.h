@@ -13,6 +13,7 @@ public:
     virtual ~LevelController() = default;
 
     virtual SwitchToNextLevel update(const utils::DeltaTime& deltaTime, const input::Input& input) = 0;
+    virtual void interpolate(float interpolation) = 0;
     virtual void activate() = 0;
     virtual void deactivate() = 0;
 };
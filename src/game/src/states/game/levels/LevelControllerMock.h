@@ -11,6 +11,7 @@ class LevelControllerMock : public LevelController
 public:
     MOCK_METHOD(SwitchToNextLevel, update, (const utils::DeltaTime& deltaTime, const input::Input& input),
                 (override));
+    MOCK_METHOD(void, interpolate, (float interpolation), (override));
     MOCK_METHOD(void, activate, (), (override));
     MOCK_METHOD(void, deactivate, (), (override));
 };
@@ -0,0 +1,102 @@
+#include "AsynchronousImageLoader.h"
+
+#include <algorithm>
+
+#include "TextureLoader.h"
+
+namespace graphics
+{
+
+AsynchronousImageLoader::AsynchronousImageLoader() : stopping{false}, worker{[this] { work(); }} {}
+
+AsynchronousImageLoader::~AsynchronousImageLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+
+    imagesRequested.notify_all();
+    worker.join();
+}
+
+void AsynchronousImageLoader::load(const TexturePath& texturePath)
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        texturePathsToLoad.push_back(texturePath);
+    }
+
+    imagesRequested.notify_one();
+}
+
+std::optional<AsynchronousImageLoader::LoadedImage> AsynchronousImageLoader::takeLoadedImage()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (loadedImages.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto loadedImage = std::move(loadedImages.front());
+    loadedImages.pop_front();
+    return loadedImage;
+}
+
+AsynchronousImageLoader::LoadedImage AsynchronousImageLoader::waitForImage(const TexturePath& texturePath)
+{
+    const auto isWaitedImage = [&](const LoadedImage& loadedImage)
+    { return loadedImage.texturePath == texturePath; };
+
+    std::unique_lock<std::mutex> lock{mutex};
+    imageLoaded.wait(lock, [&]
+                     { return std::any_of(loadedImages.begin(), loadedImages.end(), isWaitedImage); });
+
+    const auto waitedImage = std::find_if(loadedImages.begin(), loadedImages.end(), isWaitedImage);
+    auto loadedImage = std::move(*waitedImage);
+    loadedImages.erase(waitedImage);
+    return loadedImage;
+}
+
+void AsynchronousImageLoader::work()
+{
+    while (true)
+    {
+        TexturePath texturePath;
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            imagesRequested.wait(lock, [this] { return stopping or not texturePathsToLoad.empty(); });
+
+            if (stopping)
+            {
+                return;
+            }
+
+            texturePath = std::move(texturePathsToLoad.front());
+            texturePathsToLoad.pop_front();
+        }
+
+        LoadedImage loadedImage{texturePath, std::make_unique<sf::Image>(), nullptr};
+
+        try
+        {
+            TextureLoader::load(*loadedImage.image, texturePath);
+        }
+        catch (...)
+        {
+            loadedImage.image.reset();
+            loadedImage.error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            loadedImages.push_back(std::move(loadedImage));
+        }
+
+        imageLoaded.notify_all();
+    }
+}
+
+}
\ No newline at end of file
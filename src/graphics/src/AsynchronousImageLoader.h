@@ -0,0 +1,50 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "SFML/Graphics/Image.hpp"
+
+#include "TexturePath.h"
+
+namespace graphics
+{
+// images are decoded on background thread in order of requests, uploading them to textures is left to caller
+class AsynchronousImageLoader
+{
+public:
+    // image is empty and error is set when image could not be loaded
+    struct LoadedImage
+    {
+        TexturePath texturePath;
+        std::unique_ptr<sf::Image> image;
+        std::exception_ptr error;
+    };
+
+    AsynchronousImageLoader();
+    ~AsynchronousImageLoader();
+    AsynchronousImageLoader(const AsynchronousImageLoader&) = delete;
+    AsynchronousImageLoader& operator=(const AsynchronousImageLoader&) = delete;
+
+    void load(const TexturePath&);
+    std::optional<LoadedImage> takeLoadedImage();
+    // blocks until image requested earlier with load is decoded
+    LoadedImage waitForImage(const TexturePath&);
+
+private:
+    void work();
+
+    std::mutex mutex;
+    std::condition_variable imagesRequested;
+    std::condition_variable imageLoaded;
+    std::deque<TexturePath> texturePathsToLoad;
+    std::deque<LoadedImage> loadedImages;
+    bool stopping;
+    std::thread worker;
+};
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "AsynchronousImageLoader.h"
+
+#include "gtest/gtest.h"
+
+#include "ProjectPathReader.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+class AsynchronousImageLoaderTest : public Test
+{
+public:
+    const std::string testDirectory{utils::ProjectPathReader::getProjectRootPath() +
+                                    "src/graphics/src/testResources/"};
+    const std::string nonExistingTexturePath{testDirectory + "nonExistingFile"};
+    const std::string existingTexturePath{testDirectory + "attack-A1.png"};
+    AsynchronousImageLoader loader;
+};
+
+TEST_F(AsynchronousImageLoaderTest, givenNoRequestedImages_shouldNotReturnLoadedImage)
+{
+    ASSERT_FALSE(loader.takeLoadedImage());
+}
+
+TEST_F(AsynchronousImageLoaderTest, waitForExistingImage_shouldReturnDecodedImage)
+{
+    loader.load(existingTexturePath);
+
+    const auto loadedImage = loader.waitForImage(existingTexturePath);
+
+    ASSERT_EQ(loadedImage.texturePath, existingTexturePath);
+    ASSERT_TRUE(loadedImage.image);
+    ASSERT_FALSE(loadedImage.error);
+    ASSERT_NE(loadedImage.image->getSize().x, 0u);
+}
+
+TEST_F(AsynchronousImageLoaderTest, waitForNonExistingImage_shouldReturnError)
+{
+    loader.load(nonExistingTexturePath);
+
+    const auto loadedImage = loader.waitForImage(nonExistingTexturePath);
+
+    ASSERT_FALSE(loadedImage.image);
+    ASSERT_TRUE(loadedImage.error);
+}
+
+TEST_F(AsynchronousImageLoaderTest, imagesTakenAfterWaiting_shouldBeReturnedInOrderOfRequests)
+{
+    loader.load(existingTexturePath);
+    loader.load(nonExistingTexturePath);
+    loader.waitForImage(nonExistingTexturePath);
+
+    const auto loadedImage = loader.takeLoadedImage();
+
+    ASSERT_TRUE(loadedImage);
+    ASSERT_EQ(loadedImage->texturePath, existingTexturePath);
+    ASSERT_FALSE(loader.takeLoadedImage());
+}
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include "SFML/Graphics/VertexArray.hpp"
+
 #include "RectangleShape.h"
 #include "Vector.h"
 
@@ -15,8 +17,10 @@ public:
     virtual void initialize() = 0;
     virtual void clear(const Color&) = 0;
     virtual void draw(const sf::Drawable&) = 0;
+    virtual void draw(const sf::VertexArray&, const sf::Texture*) = 0;
     virtual void setView() = 0;
     virtual const utils::Vector2f& getViewSize() = 0;
+    virtual float getPixelsPerUnit() const = 0;
     virtual void setViewSize(const utils::Vector2u& windowsSize) = 0;
     virtual void synchronizeViewSize() = 0;
     virtual void setCenter(const utils::Vector2f&) = 0;
@@ -1,12 +1,21 @@
 #include "DefaultGraphicsFactory.h"
 
 #include "FontStorageSfml.h"
+#include "HeadlessRenderTarget.h"
+#include "HeadlessTextureStorage.h"
 #include "RenderTargetSfml.h"
 #include "RendererPoolSfml.h"
 #include "TextureStorageSfml.h"
 
 namespace graphics
 {
+namespace
+{
+const RendererPoolSettings rendererPoolSettings{.batchedRendering = true,
+                                                .viewCulling = true,
+                                                .bakedStaticShapes = true,
+                                                .asynchronousTextureLoading = true};
+}
 
 std::unique_ptr<RendererPool>
 DefaultGraphicsFactory::createRendererPool(std::shared_ptr<window::Window> window,
@@ -15,7 +24,18 @@ DefaultGraphicsFactory::createRendererPool(std::shared_ptr<window::Window> windo
 {
     return std::make_unique<RendererPoolSfml>(
         std::make_unique<RenderTargetSfml>(window, renderingRegionSize, logicalRegionSize),
-        std::make_unique<TextureStorageSfml>(), std::make_unique<FontStorageSfml>());
+        std::make_unique<TextureStorageSfml>(), std::make_unique<FontStorageSfml>(), rendererPoolSettings);
+}
+
+// same settings as for window, so shapes are kept in same structures as when game is displayed
+std::unique_ptr<RendererPool>
+DefaultGraphicsFactory::createHeadlessRendererPool(const utils::Vector2u& renderingRegionSize,
+                                                   const utils::Vector2u& logicalRegionSize) const
+{
+    return std::make_unique<RendererPoolSfml>(
+        std::make_unique<HeadlessRenderTarget>(renderingRegionSize, logicalRegionSize),
+        std::make_unique<HeadlessTextureStorage>(), std::make_unique<FontStorageSfml>(),
+        rendererPoolSettings);
 }
 
 }
\ No newline at end of file
@@ -12,5 +12,8 @@ public:
     std::unique_ptr<RendererPool> createRendererPool(std::shared_ptr<window::Window> window,
                                                      const utils::Vector2u& renderingRegionSize,
                                                      const utils::Vector2u& logicalRegionSize) const override;
+    std::unique_ptr<RendererPool>
+    createHeadlessRendererPool(const utils::Vector2u& renderingRegionSize,
+                               const utils::Vector2u& logicalRegionSize) const override;
 };
 }
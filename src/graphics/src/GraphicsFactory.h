@@ -16,6 +16,10 @@ public:
     virtual std::unique_ptr<RendererPool>
     createRendererPool(std::shared_ptr<window::Window> window, const utils::Vector2u& renderingRegionSize,
                        const utils::Vector2u& logicalRegionSize) const = 0;
+    // renderer pool keeping all shapes and texts up to date without drawing them or loading any texture
+    virtual std::unique_ptr<RendererPool>
+    createHeadlessRendererPool(const utils::Vector2u& renderingRegionSize,
+                               const utils::Vector2u& logicalRegionSize) const = 0;
 
     static std::unique_ptr<GraphicsFactory> createGraphicsFactory();
 };
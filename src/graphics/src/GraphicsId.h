@@ -1,8 +1,29 @@
 #pragma once
 
-#include "boost/uuid/uuid.hpp"
+#include <cstdint>
+#include <ostream>
 
 namespace graphics
 {
-using GraphicsId = boost::uuids::uuid;
-}
\ No newline at end of file
+// index of slot in renderer pool, generation tells apart graphics which reused the same slot after release
+struct GraphicsId
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+};
+
+inline bool operator==(const GraphicsId& lhs, const GraphicsId& rhs)
+{
+    return lhs.index == rhs.index and lhs.generation == rhs.generation;
+}
+
+inline bool operator!=(const GraphicsId& lhs, const GraphicsId& rhs)
+{
+    return not(lhs == rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const GraphicsId& id)
+{
+    return os << "GraphicsId{" << id.index << ", " << id.generation << "}";
+}
+}
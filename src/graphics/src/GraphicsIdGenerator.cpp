@@ -1,12 +1,15 @@
 #include "GraphicsIdGenerator.h"
 
-#include <boost/uuid/uuid_generators.hpp>
+#include <atomic>
 
 namespace graphics
 {
 
 GraphicsId GraphicsIdGenerator::generateId()
 {
-    return boost::uuids::random_generator()();
+    static std::atomic<std::uint32_t> nextIndex{0};
+
+    // renderer pool generations start from one, so generated ids never resolve to pooled graphics
+    return {nextIndex++, 0};
+}
 }
-}
\ No newline at end of file
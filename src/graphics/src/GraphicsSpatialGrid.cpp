@@ -0,0 +1,144 @@
+#include "GraphicsSpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace graphics
+{
+
+GraphicsSpatialGrid::GraphicsSpatialGrid(float cellSizeInit) : cellSize{cellSizeInit} {}
+
+void GraphicsSpatialGrid::insertOrUpdate(std::uint32_t slotIndex, const utils::FloatRect& bounds)
+{
+    if (slotIndex >= placementsOfGraphics.size())
+    {
+        placementsOfGraphics.resize(slotIndex + 1);
+    }
+
+    auto& placement = placementsOfGraphics[slotIndex];
+    const auto cellsOfGraphics = getCellRange(bounds);
+
+    if (not placement)
+    {
+        addToCells(slotIndex, cellsOfGraphics);
+    }
+    else if (placement->cellsOfGraphics != cellsOfGraphics)
+    {
+        removeFromCells(slotIndex, placement->cellsOfGraphics);
+        addToCells(slotIndex, cellsOfGraphics);
+    }
+
+    placement = GraphicsPlacement{cellsOfGraphics, bounds};
+}
+
+void GraphicsSpatialGrid::remove(std::uint32_t slotIndex)
+{
+    if (slotIndex >= placementsOfGraphics.size() or not placementsOfGraphics[slotIndex])
+    {
+        return;
+    }
+
+    removeFromCells(slotIndex, placementsOfGraphics[slotIndex]->cellsOfGraphics);
+    placementsOfGraphics[slotIndex].reset();
+}
+
+std::size_t GraphicsSpatialGrid::getNumberOfOccupiedCells() const
+{
+    return cells.size();
+}
+
+void GraphicsSpatialGrid::getSlotsIntersectingWithArea(const utils::FloatRect& area,
+                                                       std::vector<std::uint32_t>& slotIndices) const
+{
+    const auto cellsOfArea = getCellRange(area);
+
+    for (int row = cellsOfArea.firstRow; row <= cellsOfArea.lastRow; row++)
+    {
+        for (int column = cellsOfArea.firstColumn; column <= cellsOfArea.lastColumn; column++)
+        {
+            const auto cell = cells.find(getCellKey(column, row));
+
+            if (cell == cells.end())
+            {
+                continue;
+            }
+
+            for (const auto slotIndex : cell->second)
+            {
+                const auto& placement = *placementsOfGraphics[slotIndex];
+
+                // graphics spanning several cells is taken only from the first cell shared with area
+                if (column != std::max(placement.cellsOfGraphics.firstColumn, cellsOfArea.firstColumn) or
+                    row != std::max(placement.cellsOfGraphics.firstRow, cellsOfArea.firstRow))
+                {
+                    continue;
+                }
+
+                if (placement.bounds.intersects(area))
+                {
+                    slotIndices.push_back(slotIndex);
+                }
+            }
+        }
+    }
+}
+
+GraphicsSpatialGrid::CellRange GraphicsSpatialGrid::getCellRange(const utils::FloatRect& area) const
+{
+    const auto firstColumn = static_cast<int>(std::floor(area.left / cellSize));
+    const auto lastColumn =
+        std::max(firstColumn, static_cast<int>(std::ceil((area.left + area.width) / cellSize)) - 1);
+    const auto firstRow = static_cast<int>(std::floor(area.top / cellSize));
+    const auto lastRow =
+        std::max(firstRow, static_cast<int>(std::ceil((area.top + area.height) / cellSize)) - 1);
+
+    return {firstColumn, lastColumn, firstRow, lastRow};
+}
+
+GraphicsSpatialGrid::CellKey GraphicsSpatialGrid::getCellKey(int column, int row)
+{
+    return (static_cast<CellKey>(static_cast<std::uint32_t>(column)) << 32) |
+           static_cast<std::uint32_t>(row);
+}
+
+void GraphicsSpatialGrid::addToCells(std::uint32_t slotIndex, const CellRange& cellsOfGraphics)
+{
+    for (int row = cellsOfGraphics.firstRow; row <= cellsOfGraphics.lastRow; row++)
+    {
+        for (int column = cellsOfGraphics.firstColumn; column <= cellsOfGraphics.lastColumn; column++)
+        {
+            cells[getCellKey(column, row)].push_back(slotIndex);
+        }
+    }
+}
+
+void GraphicsSpatialGrid::removeFromCells(std::uint32_t slotIndex, const CellRange& cellsOfGraphics)
+{
+    for (int row = cellsOfGraphics.firstRow; row <= cellsOfGraphics.lastRow; row++)
+    {
+        for (int column = cellsOfGraphics.firstColumn; column <= cellsOfGraphics.lastColumn; column++)
+        {
+            const auto cell = cells.find(getCellKey(column, row));
+
+            if (cell == cells.end())
+            {
+                continue;
+            }
+
+            auto& cellSlots = cell->second;
+            if (const auto cellSlot = std::find(cellSlots.begin(), cellSlots.end(), slotIndex);
+                cellSlot != cellSlots.end())
+            {
+                *cellSlot = cellSlots.back();
+                cellSlots.pop_back();
+            }
+
+            if (cellSlots.empty())
+            {
+                cells.erase(cell);
+            }
+        }
+    }
+}
+
+}
\ No newline at end of file
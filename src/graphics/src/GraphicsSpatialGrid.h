@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Rect.h"
+
+namespace graphics
+{
+// graphics are identified by index of their slot in renderer pool
+class GraphicsSpatialGrid
+{
+public:
+    explicit GraphicsSpatialGrid(float cellSize);
+
+    void insertOrUpdate(std::uint32_t slotIndex, const utils::FloatRect& bounds);
+    void remove(std::uint32_t slotIndex);
+    std::size_t getNumberOfOccupiedCells() const;
+    void getSlotsIntersectingWithArea(const utils::FloatRect& area,
+                                      std::vector<std::uint32_t>& slotIndices) const;
+
+private:
+    struct CellRange
+    {
+        int firstColumn;
+        int lastColumn;
+        int firstRow;
+        int lastRow;
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    struct GraphicsPlacement
+    {
+        CellRange cellsOfGraphics;
+        utils::FloatRect bounds;
+    };
+
+    using CellKey = std::uint64_t;
+
+    CellRange getCellRange(const utils::FloatRect& area) const;
+    static CellKey getCellKey(int column, int row);
+    void addToCells(std::uint32_t slotIndex, const CellRange&);
+    void removeFromCells(std::uint32_t slotIndex, const CellRange&);
+
+    const float cellSize;
+    std::unordered_map<CellKey, std::vector<std::uint32_t>> cells;
+    std::vector<std::optional<GraphicsPlacement>> placementsOfGraphics;
+};
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "GraphicsSpatialGrid.h"
+
+#include "gtest/gtest.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+namespace
+{
+const utils::FloatRect area{0, 0, 80, 60};
+const utils::FloatRect boundsInsideOfArea{10, 10, 4, 4};
+const utils::FloatRect boundsOutsideOfArea{200, 10, 4, 4};
+const utils::FloatRect boundsCoveringManyCells{-100, 0, 400, 60};
+}
+
+class GraphicsSpatialGridTest : public Test
+{
+public:
+    std::vector<std::uint32_t> getSlotsIntersectingWithArea() const
+    {
+        std::vector<std::uint32_t> slotIndices;
+        grid.getSlotsIntersectingWithArea(area, slotIndices);
+        return slotIndices;
+    }
+
+    GraphicsSpatialGrid grid{16.f};
+};
+
+TEST_F(GraphicsSpatialGridTest, shouldReturnOnlyGraphicsIntersectingWithArea)
+{
+    grid.insertOrUpdate(0, boundsInsideOfArea);
+    grid.insertOrUpdate(1, boundsOutsideOfArea);
+
+    const std::vector<std::uint32_t> expectedSlotIndices{0};
+    ASSERT_EQ(getSlotsIntersectingWithArea(), expectedSlotIndices);
+}
+
+TEST_F(GraphicsSpatialGridTest, graphicsCoveringManyCells_shouldBeReturnedOnce)
+{
+    grid.insertOrUpdate(3, boundsCoveringManyCells);
+
+    const std::vector<std::uint32_t> expectedSlotIndices{3};
+    ASSERT_EQ(getSlotsIntersectingWithArea(), expectedSlotIndices);
+}
+
+TEST_F(GraphicsSpatialGridTest, updatedGraphics_shouldBeReturnedOnlyAtNewBounds)
+{
+    grid.insertOrUpdate(0, boundsOutsideOfArea);
+
+    grid.insertOrUpdate(0, boundsInsideOfArea);
+
+    const std::vector<std::uint32_t> expectedSlotIndices{0};
+    ASSERT_EQ(getSlotsIntersectingWithArea(), expectedSlotIndices);
+}
+
+TEST_F(GraphicsSpatialGridTest, removedGraphics_shouldNotBeReturned)
+{
+    grid.insertOrUpdate(0, boundsInsideOfArea);
+
+    grid.remove(0);
+
+    ASSERT_TRUE(getSlotsIntersectingWithArea().empty());
+}
+
+TEST_F(GraphicsSpatialGridTest, removedGraphics_shouldNotLeaveEmptyCells)
+{
+    grid.insertOrUpdate(3, boundsCoveringManyCells);
+
+    grid.remove(3);
+
+    ASSERT_EQ(grid.getNumberOfOccupiedCells(), 0u);
+}
+
+TEST_F(GraphicsSpatialGridTest, movedGraphics_shouldOccupyOnlyCellsOfNewBounds)
+{
+    grid.insertOrUpdate(0, boundsCoveringManyCells);
+
+    grid.insertOrUpdate(0, boundsInsideOfArea);
+
+    ASSERT_EQ(grid.getNumberOfOccupiedCells(), 1u);
+}
\ No newline at end of file
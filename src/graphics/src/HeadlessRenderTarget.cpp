@@ -0,0 +1,56 @@
+#include "HeadlessRenderTarget.h"
+
+#include <algorithm>
+#include <boost/numeric/conversion/cast.hpp>
+
+namespace graphics
+{
+
+HeadlessRenderTarget::HeadlessRenderTarget(const utils::Vector2u& windowSizeInit,
+                                           const utils::Vector2u& areaSizeInit)
+    : windowSize{windowSizeInit},
+      areaSize{areaSizeInit},
+      viewSize{boost::numeric_cast<float>(areaSize.x), boost::numeric_cast<float>(areaSize.y)},
+      center{boost::numeric_cast<float>(areaSize.x) / 2, boost::numeric_cast<float>(areaSize.y) / 2}
+{
+}
+
+void HeadlessRenderTarget::initialize() {}
+
+void HeadlessRenderTarget::clear(const Color&) {}
+
+void HeadlessRenderTarget::draw(const sf::Drawable&) {}
+
+void HeadlessRenderTarget::draw(const sf::VertexArray&, const sf::Texture*) {}
+
+void HeadlessRenderTarget::setView() {}
+
+void HeadlessRenderTarget::setViewSize(const utils::Vector2u& size)
+{
+    windowSize = size;
+}
+
+void HeadlessRenderTarget::synchronizeViewSize() {}
+
+const utils::Vector2f& HeadlessRenderTarget::getViewSize()
+{
+    return viewSize;
+}
+
+float HeadlessRenderTarget::getPixelsPerUnit() const
+{
+    return std::min(boost::numeric_cast<float>(windowSize.x) / boost::numeric_cast<float>(areaSize.x),
+                    boost::numeric_cast<float>(windowSize.y) / boost::numeric_cast<float>(areaSize.y));
+}
+
+void HeadlessRenderTarget::setCenter(const utils::Vector2f& newCenter)
+{
+    center = newCenter;
+}
+
+const utils::Vector2f& HeadlessRenderTarget::getCenter() const
+{
+    return center;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "ContextRenderer.h"
+#include "Vector.h"
+
+namespace graphics
+{
+// keeps view state like RenderTargetSfml, but draws nothing, so no graphics context is created
+class HeadlessRenderTarget : public ContextRenderer
+{
+public:
+    HeadlessRenderTarget(const utils::Vector2u& windowSize, const utils::Vector2u& areaSize);
+
+    void initialize() override;
+    void clear(const Color&) override;
+    void draw(const sf::Drawable&) override;
+    void draw(const sf::VertexArray&, const sf::Texture*) override;
+    void setView() override;
+    void setViewSize(const utils::Vector2u& windowsSize) override;
+    void synchronizeViewSize() override;
+    const utils::Vector2f& getViewSize() override;
+    float getPixelsPerUnit() const override;
+    void setCenter(const utils::Vector2f&) override;
+    const utils::Vector2f& getCenter() const override;
+
+private:
+    utils::Vector2u windowSize;
+    const utils::Vector2u areaSize;
+    utils::Vector2f viewSize;
+    utils::Vector2f center;
+};
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "HeadlessRenderTarget.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace graphics;
+
+namespace
+{
+const utils::Vector2u windowSize{800, 600};
+const utils::Vector2u newWindowSize{1280, 720};
+const utils::Vector2u areaSize{80, 60};
+const utils::Vector2f center{45, 25};
+}
+
+class HeadlessRenderTargetTest : public Test
+{
+public:
+    HeadlessRenderTarget renderTarget{windowSize, areaSize};
+};
+
+TEST_F(HeadlessRenderTargetTest, getViewSize_shouldReturnAreaSize)
+{
+    ASSERT_EQ(renderTarget.getViewSize(), utils::Vector2f(80, 60));
+}
+
+TEST_F(HeadlessRenderTargetTest, setCenter_getterShouldReturnSameValue)
+{
+    renderTarget.setCenter(center);
+
+    ASSERT_EQ(renderTarget.getCenter(), center);
+}
+
+TEST_F(HeadlessRenderTargetTest, getPixelsPerUnit_shouldFollowWindowSize)
+{
+    ASSERT_FLOAT_EQ(renderTarget.getPixelsPerUnit(), 10.f);
+
+    renderTarget.setViewSize(newWindowSize);
+
+    ASSERT_FLOAT_EQ(renderTarget.getPixelsPerUnit(), 12.f);
+}
\ No newline at end of file
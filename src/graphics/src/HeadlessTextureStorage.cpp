@@ -0,0 +1,20 @@
+#include "HeadlessTextureStorage.h"
+
+namespace graphics
+{
+
+const TextureRegion& HeadlessTextureStorage::getTextureRegion(const TextureRect& textureRect)
+{
+    const auto rect = textureRect.rectToCutTexture.value_or(utils::IntRect{});
+
+    return textureRegions.try_emplace(textureRect, TextureRegion{&emptyTexture, rect}).first->second;
+}
+
+const TextureRegion* HeadlessTextureStorage::requestTextureRegion(const TextureRect& textureRect)
+{
+    return &getTextureRegion(textureRect);
+}
+
+void HeadlessTextureStorage::uploadLoadedTextures(std::chrono::microseconds) {}
+
+}
\ No newline at end of file
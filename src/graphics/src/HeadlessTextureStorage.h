@@ -0,0 +1,24 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "SFML/Graphics/Texture.hpp"
+
+#include "TextureRect.h"
+#include "TextureStorage.h"
+
+namespace graphics
+{
+// texture regions point to one empty texture, so no image is read and no graphics context is created
+class HeadlessTextureStorage : public TextureStorage
+{
+public:
+    const TextureRegion& getTextureRegion(const TextureRect&) override;
+    const TextureRegion* requestTextureRegion(const TextureRect&) override;
+    void uploadLoadedTextures(std::chrono::microseconds timeBudget) override;
+
+private:
+    sf::Texture emptyTexture;
+    std::unordered_map<TextureRect, TextureRegion, TextureRectHash> textureRegions;
+};
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "HeadlessTextureStorage.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace graphics;
+
+namespace
+{
+const utils::IntRect rectToCutTexture{0, 0, 16, 32};
+const TextureRect textureRect{"notExistingTexture.png", rectToCutTexture};
+}
+
+class HeadlessTextureStorageTest : public Test
+{
+public:
+    HeadlessTextureStorage textureStorage;
+};
+
+TEST_F(HeadlessTextureStorageTest, getTextureRegion_shouldReturnRectToCutTextureWithoutLoadingImage)
+{
+    const auto& textureRegion = textureStorage.getTextureRegion(textureRect);
+
+    ASSERT_TRUE(textureRegion.texture);
+    ASSERT_EQ(textureRegion.rect, rectToCutTexture);
+}
+
+TEST_F(HeadlessTextureStorageTest, requestTextureRegion_shouldReturnSameRegionAsGetTextureRegion)
+{
+    const auto textureRegion = textureStorage.requestTextureRegion(textureRect);
+
+    ASSERT_EQ(textureRegion, &textureStorage.getTextureRegion(textureRect));
+}
\ No newline at end of file
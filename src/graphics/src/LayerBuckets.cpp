@@ -0,0 +1,85 @@
+#include "LayerBuckets.h"
+
+namespace graphics
+{
+namespace
+{
+const std::size_t minimalNumberOfHolesToRemove{16};
+}
+
+void LayerBuckets::insert(std::uint32_t slotIndex, VisibilityLayer layer)
+{
+    if (slotIndex >= placementsOfSlots.size())
+    {
+        placementsOfSlots.resize(slotIndex + 1);
+    }
+
+    append(slotIndex, layer);
+}
+
+void LayerBuckets::move(std::uint32_t slotIndex, VisibilityLayer layer)
+{
+    leaveHole(slotIndex);
+    append(slotIndex, layer);
+}
+
+void LayerBuckets::remove(std::uint32_t slotIndex)
+{
+    leaveHole(slotIndex);
+}
+
+std::size_t LayerBuckets::getOrderInLayer(std::uint32_t slotIndex) const
+{
+    return placementsOfSlots[slotIndex].orderInLayer;
+}
+
+std::size_t LayerBuckets::getNumberOfSlots(VisibilityLayer layer) const
+{
+    const auto& bucket = getBucket(layer);
+    return bucket.slotIndices.size() - bucket.numberOfHoles;
+}
+
+LayerBuckets::Bucket& LayerBuckets::getBucket(VisibilityLayer layer)
+{
+    return buckets[static_cast<std::size_t>(layer)];
+}
+
+const LayerBuckets::Bucket& LayerBuckets::getBucket(VisibilityLayer layer) const
+{
+    return buckets[static_cast<std::size_t>(layer)];
+}
+
+void LayerBuckets::append(std::uint32_t slotIndex, VisibilityLayer layer)
+{
+    auto& slotIndices = getBucket(layer).slotIndices;
+    slotIndices.push_back(slotIndex);
+    placementsOfSlots[slotIndex] = SlotPlacement{layer, slotIndices.size() - 1};
+}
+
+void LayerBuckets::leaveHole(std::uint32_t slotIndex)
+{
+    const auto& placement = placementsOfSlots[slotIndex];
+    auto& bucket = getBucket(placement.layer);
+    bucket.slotIndices[placement.orderInLayer] = hole;
+    bucket.numberOfHoles++;
+
+    // holes are removed once they take half of bucket, so each of them is moved over only once on average
+    if (bucket.numberOfHoles >= minimalNumberOfHolesToRemove and
+        bucket.numberOfHoles * 2 >= bucket.slotIndices.size())
+    {
+        removeHoles(bucket);
+    }
+}
+
+void LayerBuckets::removeHoles(Bucket& bucket)
+{
+    std::erase(bucket.slotIndices, hole);
+    bucket.numberOfHoles = 0;
+
+    for (std::size_t orderInLayer = 0; orderInLayer < bucket.slotIndices.size(); orderInLayer++)
+    {
+        placementsOfSlots[bucket.slotIndices[orderInLayer]].orderInLayer = orderInLayer;
+    }
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "VisibilityLayer.h"
+
+namespace graphics
+{
+// slots of graphics grouped by layers, graphics inserted or moved into layer is placed on top of it
+class LayerBuckets
+{
+public:
+    void insert(std::uint32_t slotIndex, VisibilityLayer);
+    void move(std::uint32_t slotIndex, VisibilityLayer);
+    void remove(std::uint32_t slotIndex);
+    std::size_t getOrderInLayer(std::uint32_t slotIndex) const;
+    std::size_t getNumberOfSlots(VisibilityLayer) const;
+    template <typename Visitor>
+    void forEachSlot(VisibilityLayer, Visitor&&) const;
+
+private:
+    // moved or removed slots leave holes, so positions of other slots in bucket stay valid
+    struct Bucket
+    {
+        std::vector<std::uint32_t> slotIndices;
+        std::size_t numberOfHoles{0};
+    };
+
+    struct SlotPlacement
+    {
+        VisibilityLayer layer;
+        std::size_t orderInLayer;
+    };
+
+    static constexpr std::uint32_t hole{std::numeric_limits<std::uint32_t>::max()};
+    static constexpr std::size_t numberOfLayers{static_cast<std::size_t>(VisibilityLayer::Invisible) + 1};
+
+    Bucket& getBucket(VisibilityLayer);
+    const Bucket& getBucket(VisibilityLayer) const;
+    void append(std::uint32_t slotIndex, VisibilityLayer);
+    void leaveHole(std::uint32_t slotIndex);
+    void removeHoles(Bucket&);
+
+    std::array<Bucket, numberOfLayers> buckets;
+    std::vector<SlotPlacement> placementsOfSlots;
+};
+
+template <typename Visitor>
+void LayerBuckets::forEachSlot(VisibilityLayer layer, Visitor&& visitor) const
+{
+    for (const auto slotIndex : getBucket(layer).slotIndices)
+    {
+        if (slotIndex != hole)
+        {
+            visitor(slotIndex);
+        }
+    }
+}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "LayerBuckets.h"
+
+#include "gtest/gtest.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+class LayerBucketsTest : public Test
+{
+public:
+    std::vector<std::uint32_t> getSlots(VisibilityLayer layer) const
+    {
+        std::vector<std::uint32_t> slotIndices;
+        layerBuckets.forEachSlot(layer, [&](std::uint32_t slotIndex) { slotIndices.push_back(slotIndex); });
+        return slotIndices;
+    }
+
+    LayerBuckets layerBuckets;
+};
+
+TEST_F(LayerBucketsTest, insertedSlots_shouldBeVisitedInOrderOfInsertionWithinTheirLayers)
+{
+    layerBuckets.insert(2, VisibilityLayer::First);
+    layerBuckets.insert(0, VisibilityLayer::Second);
+    layerBuckets.insert(1, VisibilityLayer::First);
+
+    const std::vector<std::uint32_t> expectedFirstLayerSlots{2, 1};
+    const std::vector<std::uint32_t> expectedSecondLayerSlots{0};
+    ASSERT_EQ(getSlots(VisibilityLayer::First), expectedFirstLayerSlots);
+    ASSERT_EQ(getSlots(VisibilityLayer::Second), expectedSecondLayerSlots);
+    ASSERT_TRUE(getSlots(VisibilityLayer::Invisible).empty());
+}
+
+TEST_F(LayerBucketsTest, movedSlot_shouldBePlacedOnTopOfItsNewLayer)
+{
+    layerBuckets.insert(0, VisibilityLayer::First);
+    layerBuckets.insert(1, VisibilityLayer::Second);
+    layerBuckets.insert(2, VisibilityLayer::First);
+
+    layerBuckets.move(0, VisibilityLayer::Second);
+
+    const std::vector<std::uint32_t> expectedFirstLayerSlots{2};
+    const std::vector<std::uint32_t> expectedSecondLayerSlots{1, 0};
+    ASSERT_EQ(getSlots(VisibilityLayer::First), expectedFirstLayerSlots);
+    ASSERT_EQ(getSlots(VisibilityLayer::Second), expectedSecondLayerSlots);
+    ASSERT_GT(layerBuckets.getOrderInLayer(0), layerBuckets.getOrderInLayer(1));
+}
+
+TEST_F(LayerBucketsTest, removedSlot_shouldNotBeVisited)
+{
+    layerBuckets.insert(0, VisibilityLayer::First);
+    layerBuckets.insert(1, VisibilityLayer::First);
+
+    layerBuckets.remove(0);
+
+    const std::vector<std::uint32_t> expectedSlots{1};
+    ASSERT_EQ(getSlots(VisibilityLayer::First), expectedSlots);
+    ASSERT_EQ(layerBuckets.getNumberOfSlots(VisibilityLayer::First), 1u);
+}
+
+TEST_F(LayerBucketsTest, slotsMovedBackAndForthManyTimes_shouldKeepTheirOrder)
+{
+    const std::uint32_t numberOfSlots{40};
+    for (std::uint32_t slotIndex = 0; slotIndex < numberOfSlots; slotIndex++)
+    {
+        layerBuckets.insert(slotIndex, VisibilityLayer::Second);
+    }
+
+    for (int moves = 0; moves < 100; moves++)
+    {
+        layerBuckets.move(5, VisibilityLayer::First);
+        layerBuckets.move(5, VisibilityLayer::Second);
+    }
+
+    std::vector<std::uint32_t> expectedSlots;
+    for (std::uint32_t slotIndex = 0; slotIndex < numberOfSlots; slotIndex++)
+    {
+        if (slotIndex != 5)
+        {
+            expectedSlots.push_back(slotIndex);
+        }
+    }
+    expectedSlots.push_back(5);
+    ASSERT_EQ(getSlots(VisibilityLayer::Second), expectedSlots);
+    ASSERT_GT(layerBuckets.getOrderInLayer(5), layerBuckets.getOrderInLayer(numberOfSlots - 1));
+    ASSERT_TRUE(getSlots(VisibilityLayer::First).empty());
+}
\ No newline at end of file
@@ -11,9 +11,4 @@ struct ShapeRenderingInfo
     RectangleShape shape;
     bool relativeRendering = false;
 };
-
-inline bool operator<(const ShapeRenderingInfo& lhs, const ShapeRenderingInfo& rhs)
-{
-    return lhs.layer > rhs.layer;
-}
 }
\ No newline at end of file
@@ -11,9 +11,4 @@ struct TextRenderingInfo
     Text text;
     bool relativeRendering = false;
 };
-
-inline bool operator<(const TextRenderingInfo& lhs, const TextRenderingInfo& rhs)
-{
-    return lhs.layer > rhs.layer;
-}
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "RenderTargetSfml.h"
 
+#include <algorithm>
 #include <boost/numeric/conversion/cast.hpp>
 
 namespace graphics
@@ -33,6 +34,11 @@ void RenderTargetSfml::draw(const sf::Drawable& drawable)
     sf::RenderTarget::draw(drawable);
 }
 
+void RenderTargetSfml::draw(const sf::VertexArray& vertices, const sf::Texture* texture)
+{
+    sf::RenderTarget::draw(vertices, sf::RenderStates{texture});
+}
+
 void RenderTargetSfml::setView()
 {
     view.setSize(boost::numeric_cast<float>(areaSize.x), boost::numeric_cast<float>(areaSize.y));
@@ -79,6 +85,13 @@ const utils::Vector2f& RenderTargetSfml::getViewSize()
     return view.getSize();
 }
 
+float RenderTargetSfml::getPixelsPerUnit() const
+{
+    // letterboxed view keeps aspect ratio of area, so it is scaled by smaller of window to area ratios
+    return std::min(boost::numeric_cast<float>(windowSize.x) / boost::numeric_cast<float>(areaSize.x),
+                    boost::numeric_cast<float>(windowSize.y) / boost::numeric_cast<float>(areaSize.y));
+}
+
 namespace
 {
 sf::View getLetterboxView(sf::View view, unsigned windowWidth, unsigned windowHeight)
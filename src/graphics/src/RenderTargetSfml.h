@@ -20,10 +20,12 @@ public:
     void initialize() override;
     void clear(const Color&) override;
     void draw(const sf::Drawable&) override;
+    void draw(const sf::VertexArray&, const sf::Texture*) override;
     void setView() override;
     void setViewSize(const utils::Vector2u& windowsSize) override;
     void synchronizeViewSize() override;
     const utils::Vector2f& getViewSize() override;
+    float getPixelsPerUnit() const override;
     sf::Vector2u getSize() const override;
     bool setActive(bool active) override;
     void setCenter(const utils::Vector2f&) override;
@@ -68,4 +68,13 @@ TEST_F(RendererTargetSfmlTest, setViewSize_shouldChangeWindowSize)
 
     EXPECT_EQ(size.x, newWindowSize.x);
     EXPECT_EQ(size.y, newWindowSize.y);
+}
+
+TEST_F(RendererTargetSfmlTest, pixelsPerUnit_shouldFollowLetterboxedWindowSize)
+{
+    EXPECT_FLOAT_EQ(renderTargetSfml.getPixelsPerUnit(), 10.f);
+
+    renderTargetSfml.setViewSize(newWindowSize);
+
+    EXPECT_FLOAT_EQ(renderTargetSfml.getPixelsPerUnit(), 12.f);
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Color.h"
 #include "FontPath.h"
 #include "GraphicsId.h"
+#include "RenderingStatistics.h"
 #include "TexturePath.h"
 #include "TextureRect.h"
 #include "Vector.h"
@@ -28,9 +29,11 @@ public:
                                    const Color& = Color::Black, bool = false) = 0;
     virtual void release(const GraphicsId&) = 0;
     virtual void renderAll() = 0;
+    virtual void setStatic(const GraphicsId&) = 0;
     virtual void setPosition(const GraphicsId&, const utils::Vector2f& position) = 0;
     virtual boost::optional<utils::Vector2f> getPosition(const GraphicsId&) = 0;
     virtual void setTexture(const GraphicsId&, const TextureRect&, const utils::Vector2f& scale = {1, 1}) = 0;
+    virtual void waitForTextures() = 0;
     virtual void setText(const GraphicsId&, const std::string& text) = 0;
     virtual boost::optional<std::string> getText(const GraphicsId&) const = 0;
     virtual void setVisibility(const GraphicsId&, VisibilityLayer) = 0;
@@ -43,5 +46,6 @@ public:
     virtual utils::Vector2f getSize(const GraphicsId&) const = 0;
     virtual const utils::Vector2f& getCenter() const = 0;
     virtual const utils::Vector2f& getViewSize() const = 0;
+    virtual const RenderingStatistics& getRenderingStatistics() const = 0;
 };
 }
\ No newline at end of file
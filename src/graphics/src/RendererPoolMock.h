@@ -20,9 +20,11 @@ public:
                  unsigned characterSize, VisibilityLayer, const Color&, bool relativeRendering));
     MOCK_METHOD(void, release, (const GraphicsId&));
     MOCK_METHOD(void, renderAll, ());
+    MOCK_METHOD(void, setStatic, (const GraphicsId&));
     MOCK_METHOD(void, setPosition, (const GraphicsId&, const utils::Vector2f&));
     MOCK_METHOD(boost::optional<utils::Vector2f>, getPosition, (const GraphicsId&));
     MOCK_METHOD(void, setTexture, (const GraphicsId&, const TextureRect&, const utils::Vector2f&));
+    MOCK_METHOD(void, waitForTextures, ());
     MOCK_METHOD(void, setText, (const GraphicsId&, const std::string&));
     MOCK_METHOD(boost::optional<std::string>, getText, (const GraphicsId&), (const override));
     MOCK_METHOD(void, setVisibility, (const GraphicsId&, VisibilityLayer));
@@ -35,5 +37,6 @@ public:
     MOCK_METHOD(void, setSize, (const GraphicsId&, const utils::Vector2f&));
     MOCK_METHOD(const utils::Vector2f&, getCenter, (), (const));
     MOCK_METHOD(const utils::Vector2f&, getViewSize, (), (const));
+    MOCK_METHOD(const RenderingStatistics&, getRenderingStatistics, (), (const));
 };
 }
\ No newline at end of file
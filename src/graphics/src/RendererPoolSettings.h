@@ -0,0 +1,22 @@
+#pragma once
+
+#include <chrono>
+
+namespace graphics
+{
+struct RendererPoolSettings
+{
+    // shapes from same layer sharing texture are drawn together as one vertex array
+    bool batchedRendering{false};
+    // graphics outside of view are skipped, relatively rendered graphics are always drawn
+    bool viewCulling{false};
+    // static shapes are baked into textures of chunks with given size in world units, one draw call per chunk
+    // chunk textures have resolution of view, so baked shapes are not scaled down
+    bool bakedStaticShapes{false};
+    float staticChunkSize{64.f};
+    unsigned maxStaticChunkTextureSize{2048};
+    // textures are decoded in background and uploaded within time budget of each frame
+    bool asynchronousTextureLoading{false};
+    std::chrono::microseconds textureUploadTimeBudget{2000};
+};
+}
\ No newline at end of file
@@ -1,51 +1,34 @@
 #include "RendererPoolSfml.h"
 
-#include <iostream>
+#include <algorithm>
+#include <array>
+#include <utility>
 
-#include "GraphicsIdGenerator.h"
+#include "exceptions/TextureNotAvailable.h"
 
 namespace graphics
 {
 namespace
 {
-static auto& getLayeredShapeByPosition(std::vector<ShapeRenderingInfo>& shapes,
-                                       std::vector<ShapeRenderingInfo>::const_iterator position)
-{
-    const auto distance =
-        std::vector<ShapeRenderingInfo>::size_type(std::distance(shapes.cbegin(), position));
-    return shapes.at(distance);
-}
-
-static auto& getLayeredShapeByPosition(const std::vector<ShapeRenderingInfo>& shapes,
-                                       std::vector<ShapeRenderingInfo>::const_iterator position)
-{
-    const auto distance =
-        std::vector<ShapeRenderingInfo>::size_type(std::distance(shapes.cbegin(), position));
-    return shapes.at(distance);
-}
-
-static auto& getLayeredTextByPosition(std::vector<TextRenderingInfo>& texts,
-                                      std::vector<TextRenderingInfo>::const_iterator position)
-{
-    const auto distance = std::vector<TextRenderingInfo>::size_type(std::distance(texts.cbegin(), position));
-    return texts.at(distance);
-}
-
-static auto& getLayeredTextByPosition(const std::vector<TextRenderingInfo>& layeredTexts,
-                                      std::vector<TextRenderingInfo>::const_iterator position)
-{
-    const auto distance =
-        std::vector<TextRenderingInfo>::size_type(std::distance(layeredTexts.cbegin(), position));
-    return layeredTexts.at(distance);
-}
+const float shapesGridCellSize{16.f};
+const std::array<VisibilityLayer, 4> renderedLayers{VisibilityLayer::Background, VisibilityLayer::Third,
+                                                     VisibilityLayer::Second, VisibilityLayer::First};
 }
 
 RendererPoolSfml::RendererPoolSfml(std::unique_ptr<ContextRenderer> contextRendererInit,
                                    std::unique_ptr<TextureStorage> textureStorageInit,
-                                   std::unique_ptr<FontStorage> fontStorageInit)
+                                   std::unique_ptr<FontStorage> fontStorageInit,
+                                   const RendererPoolSettings& settingsInit)
     : contextRenderer{std::move(contextRendererInit)},
       textureStorage{std::move(textureStorageInit)},
-      fontStorage{std::move(fontStorageInit)}
+      fontStorage{std::move(fontStorageInit)},
+      settings{settingsInit},
+      numberOfUsedSpriteBatches{0},
+      shapesGrid{shapesGridCellSize},
+      staticChunks{settings.staticChunkSize, settings.maxStaticChunkTextureSize,
+                   [this](std::uint32_t slotIndex) -> const RectangleShape&
+                   { return layeredShapes[slots[slotIndex].position].shape; },
+                   [this](std::uint32_t slotIndex) { return shapesLayers.getOrderInLayer(slotIndex); }}
 {
     contextRenderer->initialize();
     contextRenderer->setView();
@@ -54,10 +37,18 @@ RendererPoolSfml::RendererPoolSfml(std::unique_ptr<ContextRenderer> contextRende
 GraphicsId RendererPoolSfml::acquire(const utils::Vector2f& size, const utils::Vector2f& position,
                                      const Color& color, VisibilityLayer layer, bool relativeRendering)
 {
-    auto id = GraphicsIdGenerator::generateId();
-    auto layeredShape =
-        ShapeRenderingInfo{layer, RectangleShape{id, size, position, color}, relativeRendering};
-    layeredShapes.insert(upper_bound(layeredShapes.begin(), layeredShapes.end(), layeredShape), layeredShape);
+    const auto id = acquireSlot(GraphicsKind::Shape);
+    layeredShapes.push_back(
+        ShapeRenderingInfo{layer, RectangleShape{id, size, position, color}, relativeRendering});
+    slots[id.index].position = layeredShapes.size() - 1;
+    shapesLayers.insert(id.index, layer);
+
+    if (settings.viewCulling and relativeRendering)
+    {
+        relativelyRenderedShapesSlots.push_back(id.index);
+    }
+
+    updateShapePlacement(id);
     return id;
 }
 
@@ -73,17 +64,18 @@ GraphicsId RendererPoolSfml::acquireText(const utils::Vector2f& position, const
                                          const FontPath& fontPath, unsigned characterSize,
                                          VisibilityLayer layer, const Color& color, bool relativeRendering)
 {
-    auto id = GraphicsIdGenerator::generateId();
     const auto& font = fontStorage->getFont(fontPath);
-    auto layeredText =
-        TextRenderingInfo{layer, Text{id, position, text, font, characterSize, color}, relativeRendering};
-    layeredTexts.insert(upper_bound(layeredTexts.begin(), layeredTexts.end(), layeredText), layeredText);
+    const auto id = acquireSlot(GraphicsKind::Text);
+    layeredTexts.push_back(
+        TextRenderingInfo{layer, Text{id, position, text, font, characterSize, color}, relativeRendering});
+    slots[id.index].position = layeredTexts.size() - 1;
+    textsLayers.insert(id.index, layer);
     return id;
 }
 
 void RendererPoolSfml::release(const GraphicsId& id)
 {
-    graphicsObjectsToRemove.insert(id);
+    graphicsObjectsToRemove.push_back(id);
 }
 
 void RendererPoolSfml::renderAll()
@@ -95,74 +87,86 @@ void RendererPoolSfml::renderAll()
         cleanUnusedShapes();
     }
 
+    if (not shapesWaitingForTextures.empty())
+    {
+        textureStorage->uploadLoadedTextures(settings.textureUploadTimeBudget);
+        setUploadedTextures();
+    }
+
     contextRenderer->setView();
     auto viewCenter = contextRenderer->getCenter();
     auto viewSize = contextRenderer->getViewSize();
     auto relativeOffset = viewCenter - viewSize / 2.0f;
+    const auto viewArea = utils::FloatRect{relativeOffset, viewSize};
+    renderingStatistics = {};
 
-    for (auto& layeredShape : layeredShapes)
+    collectShapesInView(viewArea);
+
+    if (settings.bakedStaticShapes)
     {
-        if (layeredShape.layer != VisibilityLayer::Invisible)
-        {
-            if (layeredShape.relativeRendering)
-            {
-                layeredShape.shape.move(relativeOffset);
-                contextRenderer->draw(layeredShape.shape);
-                layeredShape.shape.move(-relativeOffset);
-            }
-            else
-            {
-                contextRenderer->draw(layeredShape.shape);
-            }
-        }
+        staticChunks.setPixelsPerUnit(contextRenderer->getPixelsPerUnit());
     }
 
-    for (auto& layeredText : layeredTexts)
+    // invisible layer is never rendered, so its graphics are not even visited
+    for (const auto layer : renderedLayers)
     {
-        if (layeredText.layer != VisibilityLayer::Invisible)
-        {
-            if (layeredText.relativeRendering)
-            {
-                layeredText.text.move(relativeOffset);
-                contextRenderer->draw(layeredText.text);
-                layeredText.text.move(-relativeOffset);
-            }
-            else
-            {
-                contextRenderer->draw(layeredText.text);
-            }
-        }
+        staticChunks.render(layer, viewArea, *contextRenderer, renderingStatistics);
+        collectShapesToRender(layer);
+        renderShapes(relativeOffset);
+    }
+
+    for (const auto layer : renderedLayers)
+    {
+        renderTexts(layer, viewArea, relativeOffset);
+    }
+}
+
+void RendererPoolSfml::setStatic(const GraphicsId& id)
+{
+    if (not settings.bakedStaticShapes)
+    {
+        return;
+    }
+
+    // relatively rendered shapes move together with view, so they can not be baked
+    if (const auto layeredShape = findLayeredShape(id); layeredShape and not layeredShape->relativeRendering)
+    {
+        shapesGrid.remove(id.index);
+        staticChunks.insertOrUpdate(id.index, layeredShape->layer, layeredShape->shape.getGlobalBounds());
     }
 }
 
 void RendererPoolSfml::setPosition(const GraphicsId& id, const utils::Vector2f& newPosition)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        layeredShape.shape.setPosition(newPosition);
+        // unchanged static shape must not be baked again
+        if (layeredShape->shape.getPosition() == newPosition)
+        {
+            return;
+        }
+
+        layeredShape->shape.setPosition(newPosition);
+        updateShapePlacement(id);
         return;
     }
 
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        layeredText.text.setPosition(newPosition);
+        layeredText->text.setPosition(newPosition);
     }
 }
 
 boost::optional<utils::Vector2f> RendererPoolSfml::getPosition(const GraphicsId& id)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        const auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        return layeredShape.shape.getPosition();
+        return layeredShape->shape.getPosition();
     }
 
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        const auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        return layeredText.text.getPosition();
+        return layeredText->text.getPosition();
     }
 
     return boost::none;
@@ -171,38 +175,89 @@ boost::optional<utils::Vector2f> RendererPoolSfml::getPosition(const GraphicsId&
 void RendererPoolSfml::setTexture(const GraphicsId& id, const TextureRect& textureRect,
                                   const utils::Vector2f& scale)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    const auto layeredShape = findLayeredShape(id);
+
+    if (not layeredShape)
+    {
+        return;
+    }
+
+    if (not settings.asynchronousTextureLoading)
+    {
+        applyTexture(*layeredShape, textureStorage->getTextureRegion(textureRect), scale);
+        updateShapePlacement(id);
+        return;
+    }
+
+    const auto textureRegion = textureStorage->requestTextureRegion(textureRect);
+    const auto shapeWaitingForTexture = findShapeWaitingForTexture(id);
+
+    if (textureRegion)
     {
-        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        const sf::Texture& texture = textureStorage->getTexture(textureRect);
-        layeredShape.shape.setTexture(&texture, true);
-        layeredShape.shape.setScale(scale);
-        if (scale.x < 0)
+        if (shapeWaitingForTexture != shapesWaitingForTextures.end())
         {
-            layeredShape.shape.setOrigin(layeredShape.shape.getGlobalBounds().width / (-scale.x), 0);
+            if (shapeWaitingForTexture->colorToRestore)
+            {
+                layeredShape->shape.setFillColor(*shapeWaitingForTexture->colorToRestore);
+            }
+            shapesWaitingForTextures.erase(shapeWaitingForTexture);
         }
-        else
+
+        applyTexture(*layeredShape, *textureRegion, scale);
+        updateShapePlacement(id);
+        return;
+    }
+
+    // shape keeps its previous texture until requested one is uploaded
+    if (shapeWaitingForTexture != shapesWaitingForTextures.end())
+    {
+        shapeWaitingForTexture->textureRect = textureRect;
+        shapeWaitingForTexture->scale = scale;
+        return;
+    }
+
+    std::optional<Color> colorToRestore;
+
+    if (layeredShape->shape.getTexture() == nullptr)
+    {
+        colorToRestore = layeredShape->shape.getFillColor();
+        layeredShape->shape.setFillColor(Color::Transparent);
+        updateShapePlacement(id);
+    }
+
+    shapesWaitingForTextures.push_back(ShapeWaitingForTexture{id, textureRect, scale, colorToRestore});
+}
+
+void RendererPoolSfml::waitForTextures()
+{
+    for (const auto& shapeWaitingForTexture : shapesWaitingForTextures)
+    {
+        try
+        {
+            textureStorage->getTextureRegion(shapeWaitingForTexture.textureRect);
+        }
+        catch (const exceptions::TextureNotAvailable&)
         {
-            layeredShape.shape.setOrigin(0, 0);
+            // shape is given back its color when its waiting is finished with uploaded textures
         }
     }
+
+    setUploadedTextures();
 }
 
 void RendererPoolSfml::setText(const GraphicsId& id, const std::string& text)
 {
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        layeredText.text.setString(text);
+        layeredText->text.setString(text);
     }
 }
 
 boost::optional<std::string> RendererPoolSfml::getText(const GraphicsId& id) const
 {
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        const auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        return layeredText.text.getText();
+        return layeredText->text.getText();
     }
 
     return boost::none;
@@ -210,56 +265,58 @@ boost::optional<std::string> RendererPoolSfml::getText(const GraphicsId& id) con
 
 void RendererPoolSfml::setVisibility(const GraphicsId& id, VisibilityLayer layer)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        auto layeredShape = *layeredShapeIter;
-        layeredShape.layer = layer;
-        layeredShapes.erase(layeredShapeIter);
-        layeredShapes.insert(upper_bound(layeredShapes.begin(), layeredShapes.end(), layeredShape),
-                             layeredShape);
+        layeredShape->layer = layer;
+        shapesLayers.move(id.index, layer);
+        updateShapePlacement(id);
         return;
     }
 
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        auto layeredText = *layeredTextIter;
-        layeredText.layer = layer;
-        layeredTexts.erase(layeredTextIter);
-        layeredTexts.insert(upper_bound(layeredTexts.begin(), layeredTexts.end(), layeredText), layeredText);
+        layeredText->layer = layer;
+        textsLayers.move(id.index, layer);
     }
 }
 
 void RendererPoolSfml::setColor(const GraphicsId& id, const Color& color)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        layeredShape.shape.setFillColor(color);
+        if (const auto shapeWaitingForTexture = findShapeWaitingForTexture(id);
+            shapeWaitingForTexture != shapesWaitingForTextures.end() and
+            shapeWaitingForTexture->colorToRestore)
+        {
+            shapeWaitingForTexture->colorToRestore = color;
+            return;
+        }
+
+        layeredShape->shape.setFillColor(color);
+        updateShapePlacement(id);
         return;
     }
 
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        layeredText.text.setFillColor(color);
+        layeredText->text.setFillColor(color);
     }
 }
 
 void RendererPoolSfml::setOutline(const GraphicsId& id, float thickness, const Color& color)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        layeredShape.shape.setOutlineThickness(thickness);
-        layeredShape.shape.setOutlineColor(color);
+        layeredShape->shape.setOutlineThickness(thickness);
+        layeredShape->shape.setOutlineColor(color);
+        updateShapePlacement(id);
         return;
     }
 
-    if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
+    if (const auto layeredText = findLayeredText(id))
     {
-        auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        layeredText.text.setOutlineThickness(thickness);
-        layeredText.text.setOutlineColor(color);
+        layeredText->text.setOutlineThickness(thickness);
+        layeredText->text.setOutlineColor(color);
     }
 }
 
@@ -280,10 +337,9 @@ void RendererPoolSfml::setCenter(const utils::Vector2f& movement)
 
 utils::Vector2f RendererPoolSfml::getSize(const GraphicsId& id) const
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        return layeredShape.shape.getSize();
+        return layeredShape->shape.getSize();
     }
 
     throw std::runtime_error{"cant get size"};
@@ -291,11 +347,10 @@ utils::Vector2f RendererPoolSfml::getSize(const GraphicsId& id) const
 
 void RendererPoolSfml::setSize(const GraphicsId& id, const utils::Vector2f& size)
 {
-    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    if (const auto layeredShape = findLayeredShape(id))
     {
-        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        layeredShape.shape.setSize(size);
-        return;
+        layeredShape->shape.setSize(size);
+        updateShapePlacement(id);
     }
 }
 
@@ -308,36 +363,383 @@ const utils::Vector2f& RendererPoolSfml::getViewSize() const
     return contextRenderer->getViewSize();
 }
 
-void RendererPoolSfml::cleanUnusedShapes()
+const RenderingStatistics& RendererPoolSfml::getRenderingStatistics() const
 {
-    layeredShapes.erase(
-        std::remove_if(layeredShapes.begin(), layeredShapes.end(),
-                       [&](const ShapeRenderingInfo& layeredShape)
-                       { return graphicsObjectsToRemove.count(layeredShape.shape.getGraphicsId()); }),
-        layeredShapes.end());
+    return renderingStatistics;
+}
 
-    layeredTexts.erase(
-        std::remove_if(layeredTexts.begin(), layeredTexts.end(),
-                       [&](const TextRenderingInfo& layeredText)
-                       { return graphicsObjectsToRemove.count(layeredText.text.getGraphicsId()); }),
-        layeredTexts.end());
+template <typename Graphics>
+void RendererPoolSfml::draw(Graphics& graphics, bool relativeRendering, const utils::Vector2f& relativeOffset)
+{
+    if (relativeRendering)
+    {
+        graphics.move(relativeOffset);
+        contextRenderer->draw(graphics);
+        graphics.move(-relativeOffset);
+    }
+    else
+    {
+        contextRenderer->draw(graphics);
+    }
 
-    graphicsObjectsToRemove.clear();
+    renderingStatistics.numberOfDrawCalls++;
+}
+
+void RendererPoolSfml::collectShapesInView(const utils::FloatRect& viewArea)
+{
+    if (not settings.viewCulling)
+    {
+        return;
+    }
+
+    shapesSlotsInView.clear();
+    shapesGrid.getSlotsIntersectingWithArea(viewArea, shapesSlotsInView);
+    shapesSlotsInView.insert(shapesSlotsInView.end(), relativelyRenderedShapesSlots.begin(),
+                             relativelyRenderedShapesSlots.end());
+}
+
+void RendererPoolSfml::collectShapesToRender(VisibilityLayer layer)
+{
+    shapesSlotsToRender.clear();
+
+    if (not settings.viewCulling)
+    {
+        shapesLayers.forEachSlot(layer,
+                                 [&](std::uint32_t slotIndex)
+                                 {
+                                     if (not staticChunks.contains(slotIndex))
+                                     {
+                                         shapesSlotsToRender.push_back(slotIndex);
+                                     }
+                                 });
+        return;
+    }
+
+    for (const auto slotIndex : shapesSlotsInView)
+    {
+        if (layeredShapes[slots[slotIndex].position].layer == layer)
+        {
+            shapesSlotsToRender.push_back(slotIndex);
+        }
+    }
+
+    // shapes in view are found in arbitrary order, drawing order within layer comes from its bucket
+    std::sort(shapesSlotsToRender.begin(), shapesSlotsToRender.end(),
+              [&](std::uint32_t lhs, std::uint32_t rhs)
+              { return shapesLayers.getOrderInLayer(lhs) < shapesLayers.getOrderInLayer(rhs); });
+}
+
+void RendererPoolSfml::renderShapes(const utils::Vector2f& relativeOffset)
+{
+    for (const auto slotIndex : shapesSlotsToRender)
+    {
+        auto& layeredShape = layeredShapes[slots[slotIndex].position];
+
+        if (not settings.batchedRendering)
+        {
+            draw(layeredShape.shape, layeredShape.relativeRendering, relativeOffset);
+        }
+        else if (canBeBatched(layeredShape.shape))
+        {
+            addToSpriteBatch(layeredShape, relativeOffset);
+        }
+        else
+        {
+            // shapes batched so far in this layer have to stay under this one
+            drawSpriteBatches();
+            draw(layeredShape.shape, layeredShape.relativeRendering, relativeOffset);
+        }
+    }
+
+    drawSpriteBatches();
+}
+
+void RendererPoolSfml::renderTexts(VisibilityLayer layer, const utils::FloatRect& viewArea,
+                                   const utils::Vector2f& relativeOffset)
+{
+    textsLayers.forEachSlot(layer,
+                            [&](std::uint32_t slotIndex)
+                            {
+                                auto& layeredText = layeredTexts[slots[slotIndex].position];
+
+                                if (settings.viewCulling and not layeredText.relativeRendering and
+                                    not layeredText.text.getGlobalBounds().intersects(viewArea))
+                                {
+                                    return;
+                                }
+
+                                draw(layeredText.text, layeredText.relativeRendering, relativeOffset);
+                            });
+}
+
+bool RendererPoolSfml::canBeBatched(const RectangleShape& shape)
+{
+    return shape.getOutlineThickness() == 0 and shape.getRotation() == 0;
+}
+
+void RendererPoolSfml::addToSpriteBatch(const ShapeRenderingInfo& layeredShape,
+                                        const utils::Vector2f& relativeOffset)
+{
+    const auto& shape = layeredShape.shape;
+    const auto position =
+        layeredShape.relativeRendering ? shape.getPosition() + relativeOffset : shape.getPosition();
+    const auto& size = shape.getSize();
+    const auto& origin = shape.getOrigin();
+    const auto& scale = shape.getScale();
+
+    const auto left = position.x - origin.x * scale.x;
+    const auto top = position.y - origin.y * scale.y;
+    const auto right = left + size.x * scale.x;
+    const auto bottom = top + size.y * scale.y;
+
+    const auto& textureRect = shape.getTextureRect();
+    const auto textureLeft = static_cast<float>(textureRect.left);
+    const auto textureTop = static_cast<float>(textureRect.top);
+    const auto textureRight = static_cast<float>(textureRect.left + textureRect.width);
+    const auto textureBottom = static_cast<float>(textureRect.top + textureRect.height);
+
+    const auto& color = shape.getFillColor();
+    const sf::Vertex topLeft{{left, top}, color, {textureLeft, textureTop}};
+    const sf::Vertex topRight{{right, top}, color, {textureRight, textureTop}};
+    const sf::Vertex bottomLeft{{left, bottom}, color, {textureLeft, textureBottom}};
+    const sf::Vertex bottomRight{{right, bottom}, color, {textureRight, textureBottom}};
+
+    auto& vertices = getSpriteBatch(shape.getTexture()).vertices;
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+}
+
+RendererPoolSfml::SpriteBatch& RendererPoolSfml::getSpriteBatch(const sf::Texture* texture)
+{
+    // only latest batch is extended, shape added to earlier one would be drawn below shapes added after it
+    if (numberOfUsedSpriteBatches > 0 and spriteBatches[numberOfUsedSpriteBatches - 1].texture == texture)
+    {
+        return spriteBatches[numberOfUsedSpriteBatches - 1];
+    }
+
+    // batches are reused between frames to keep memory of their vertex arrays
+    if (numberOfUsedSpriteBatches == spriteBatches.size())
+    {
+        spriteBatches.push_back(SpriteBatch{nullptr, sf::VertexArray{sf::Triangles}});
+    }
+
+    auto& spriteBatch = spriteBatches[numberOfUsedSpriteBatches++];
+    spriteBatch.texture = texture;
+    spriteBatch.vertices.clear();
+    return spriteBatch;
+}
+
+void RendererPoolSfml::drawSpriteBatches()
+{
+    for (std::size_t batchIndex = 0; batchIndex < numberOfUsedSpriteBatches; batchIndex++)
+    {
+        const auto& spriteBatch = spriteBatches[batchIndex];
+        contextRenderer->draw(spriteBatch.vertices, spriteBatch.texture);
+        renderingStatistics.numberOfDrawCalls++;
+        renderingStatistics.numberOfVertices += spriteBatch.vertices.getVertexCount();
+    }
+
+    numberOfUsedSpriteBatches = 0;
+}
+
+void RendererPoolSfml::updateShapePlacement(const GraphicsId& id)
+{
+    const auto& layeredShape = *findLayeredShape(id);
+
+    if (staticChunks.contains(id.index))
+    {
+        staticChunks.insertOrUpdate(id.index, layeredShape.layer, layeredShape.shape.getGlobalBounds());
+    }
+    else if (settings.viewCulling and not layeredShape.relativeRendering)
+    {
+        shapesGrid.insertOrUpdate(id.index, layeredShape.shape.getGlobalBounds());
+    }
+}
+
+void RendererPoolSfml::applyTexture(ShapeRenderingInfo& layeredShape, const TextureRegion& textureRegion,
+                                    const utils::Vector2f& scale)
+{
+    layeredShape.shape.setTexture(textureRegion.texture);
+    layeredShape.shape.setTextureRect(textureRegion.rect);
+    layeredShape.shape.setScale(scale);
+    if (scale.x < 0)
+    {
+        layeredShape.shape.setOrigin(layeredShape.shape.getGlobalBounds().width / (-scale.x), 0);
+    }
+    else
+    {
+        layeredShape.shape.setOrigin(0, 0);
+    }
 }
 
-std::vector<ShapeRenderingInfo>::const_iterator
-RendererPoolSfml::findLayeredShapePosition(const GraphicsId& graphicsIdToFind) const
+void RendererPoolSfml::setUploadedTextures()
 {
-    return std::find_if(layeredShapes.begin(), layeredShapes.end(),
-                        [&graphicsIdToFind](const ShapeRenderingInfo& layeredShape)
-                        { return layeredShape.shape.getGraphicsId() == graphicsIdToFind; });
+    std::erase_if(shapesWaitingForTextures,
+                  [this](const ShapeWaitingForTexture& shapeWaitingForTexture)
+                  {
+                      const auto layeredShape = findLayeredShape(shapeWaitingForTexture.id);
+
+                      if (not layeredShape)
+                      {
+                          return true;
+                      }
+
+                      const TextureRegion* textureRegion{nullptr};
+
+                      try
+                      {
+                          textureRegion =
+                              textureStorage->requestTextureRegion(shapeWaitingForTexture.textureRect);
+
+                          if (not textureRegion)
+                          {
+                              return false;
+                          }
+                      }
+                      catch (const exceptions::TextureNotAvailable&)
+                      {
+                          // unavailable texture was reported by storage, shape is shown without it
+                      }
+
+                      if (shapeWaitingForTexture.colorToRestore)
+                      {
+                          layeredShape->shape.setFillColor(*shapeWaitingForTexture.colorToRestore);
+                      }
+
+                      if (textureRegion)
+                      {
+                          applyTexture(*layeredShape, *textureRegion, shapeWaitingForTexture.scale);
+                      }
+
+                      updateShapePlacement(shapeWaitingForTexture.id);
+                      return true;
+                  });
 }
 
-std::vector<TextRenderingInfo>::const_iterator
-RendererPoolSfml::findLayeredTextPosition(const GraphicsId& graphicsIdToFind) const
+std::vector<RendererPoolSfml::ShapeWaitingForTexture>::iterator
+RendererPoolSfml::findShapeWaitingForTexture(const GraphicsId& id)
 {
-    return std::find_if(layeredTexts.begin(), layeredTexts.end(),
-                        [&graphicsIdToFind](const TextRenderingInfo& layeredText)
-                        { return layeredText.text.getGraphicsId() == graphicsIdToFind; });
+    return std::find_if(shapesWaitingForTextures.begin(), shapesWaitingForTextures.end(),
+                        [&](const ShapeWaitingForTexture& shapeWaitingForTexture)
+                        { return shapeWaitingForTexture.id == id; });
 }
+
+GraphicsId RendererPoolSfml::acquireSlot(GraphicsKind kind)
+{
+    if (freeSlots.empty())
+    {
+        slots.push_back(GraphicsSlot{1, GraphicsKind::None, 0});
+        freeSlots.push_back(static_cast<std::uint32_t>(slots.size() - 1));
+    }
+
+    const auto index = freeSlots.back();
+    freeSlots.pop_back();
+    slots[index].kind = kind;
+    return {index, slots[index].generation};
+}
+
+const RendererPoolSfml::GraphicsSlot* RendererPoolSfml::findSlot(const GraphicsId& id,
+                                                                GraphicsKind kind) const
+{
+    if (id.index >= slots.size())
+    {
+        return nullptr;
+    }
+
+    const auto& slot = slots[id.index];
+
+    if (slot.generation != id.generation or slot.kind != kind)
+    {
+        return nullptr;
+    }
+
+    return &slot;
+}
+
+ShapeRenderingInfo* RendererPoolSfml::findLayeredShape(const GraphicsId& id)
+{
+    return const_cast<ShapeRenderingInfo*>(std::as_const(*this).findLayeredShape(id));
+}
+
+const ShapeRenderingInfo* RendererPoolSfml::findLayeredShape(const GraphicsId& id) const
+{
+    const auto slot = findSlot(id, GraphicsKind::Shape);
+    return slot ? &layeredShapes[slot->position] : nullptr;
+}
+
+TextRenderingInfo* RendererPoolSfml::findLayeredText(const GraphicsId& id)
+{
+    return const_cast<TextRenderingInfo*>(std::as_const(*this).findLayeredText(id));
+}
+
+const TextRenderingInfo* RendererPoolSfml::findLayeredText(const GraphicsId& id) const
+{
+    const auto slot = findSlot(id, GraphicsKind::Text);
+    return slot ? &layeredTexts[slot->position] : nullptr;
+}
+
+void RendererPoolSfml::removeLayeredShape(std::uint32_t slotIndex)
+{
+    // last shape fills place of removed one, drawing order is kept by layer buckets
+    const auto position = slots[slotIndex].position;
+
+    if (position + 1 != layeredShapes.size())
+    {
+        layeredShapes[position] = std::move(layeredShapes.back());
+        slots[layeredShapes[position].shape.getGraphicsId().index].position = position;
+    }
+
+    layeredShapes.pop_back();
+
+    shapesLayers.remove(slotIndex);
+}
+
+void RendererPoolSfml::removeLayeredText(std::uint32_t slotIndex)
+{
+    const auto position = slots[slotIndex].position;
+
+    if (position + 1 != layeredTexts.size())
+    {
+        layeredTexts[position] = std::move(layeredTexts.back());
+        slots[layeredTexts[position].text.getGraphicsId().index].position = position;
+    }
+
+    layeredTexts.pop_back();
+
+    textsLayers.remove(slotIndex);
+}
+
+void RendererPoolSfml::cleanUnusedShapes()
+{
+    // bumped generation invalidates released ids, so graphics released twice is removed only once
+    for (const auto& id : graphicsObjectsToRemove)
+    {
+        if (findSlot(id, GraphicsKind::Shape))
+        {
+            shapesGrid.remove(id.index);
+            staticChunks.remove(id.index);
+            std::erase(relativelyRenderedShapesSlots, id.index);
+            removeLayeredShape(id.index);
+        }
+        else if (findSlot(id, GraphicsKind::Text))
+        {
+            removeLayeredText(id.index);
+        }
+        else
+        {
+            continue;
+        }
+
+        auto& slot = slots[id.index];
+        slot.generation++;
+        slot.kind = GraphicsKind::None;
+        freeSlots.push_back(id.index);
+    }
+
+    graphicsObjectsToRemove.clear();
 }
+}
\ No newline at end of file
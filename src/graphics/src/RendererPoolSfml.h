@@ -1,17 +1,19 @@
 #pragma once
 
-#include <boost/functional/hash.hpp>
 #include <memory>
-#include <unordered_set>
+#include <optional>
 #include <vector>
 
 #include "ContextRenderer.h"
 #include "FontStorage.h"
-#include "GraphicsIdGenerator.h"
+#include "GraphicsSpatialGrid.h"
+#include "LayerBuckets.h"
 #include "LayeredShape.h"
 #include "LayeredText.h"
 #include "RectangleShape.h"
 #include "RendererPool.h"
+#include "RendererPoolSettings.h"
+#include "StaticChunks.h"
 #include "Text.h"
 #include "TextureStorage.h"
 
@@ -21,7 +23,7 @@ class RendererPoolSfml : public RendererPool
 {
 public:
     RendererPoolSfml(std::unique_ptr<ContextRenderer>, std::unique_ptr<TextureStorage>,
-                     std::unique_ptr<FontStorage>);
+                     std::unique_ptr<FontStorage>, const RendererPoolSettings& = {});
 
     GraphicsId acquire(const utils::Vector2f& size, const utils::Vector2f& position, const Color&,
                        VisibilityLayer = VisibilityLayer::First, bool = false) override;
@@ -32,9 +34,11 @@ public:
                            const Color& = Color::Black, bool = false) override;
     void release(const GraphicsId&) override;
     void renderAll() override;
+    void setStatic(const GraphicsId&) override;
     void setPosition(const GraphicsId&, const utils::Vector2f& position) override;
     boost::optional<utils::Vector2f> getPosition(const GraphicsId&) override;
     void setTexture(const GraphicsId&, const TextureRect&, const utils::Vector2f& scale = {1, 1}) override;
+    void waitForTextures() override;
     void setText(const GraphicsId&, const std::string& text) override;
     boost::optional<std::string> getText(const GraphicsId&) const override;
     void setVisibility(const GraphicsId&, VisibilityLayer) override;
@@ -47,17 +51,83 @@ public:
     void setSize(const GraphicsId&, const utils::Vector2f&) override;
     const utils::Vector2f& getCenter() const override;
     const utils::Vector2f& getViewSize() const override;
+    const RenderingStatistics& getRenderingStatistics() const override;
 
 private:
+    enum class GraphicsKind
+    {
+        None,
+        Shape,
+        Text
+    };
+
+    // position is index of graphics in unordered layered shapes or layered texts
+    struct GraphicsSlot
+    {
+        std::uint32_t generation;
+        GraphicsKind kind;
+        std::size_t position;
+    };
+
+    // shape without any texture is hidden until its first texture is uploaded
+    struct ShapeWaitingForTexture
+    {
+        GraphicsId id;
+        TextureRect textureRect;
+        utils::Vector2f scale;
+        std::optional<Color> colorToRestore;
+    };
+
+    struct SpriteBatch
+    {
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    template <typename Graphics>
+    void draw(Graphics&, bool relativeRendering, const utils::Vector2f& relativeOffset);
+    void collectShapesInView(const utils::FloatRect& viewArea);
+    void collectShapesToRender(VisibilityLayer);
+    void renderShapes(const utils::Vector2f& relativeOffset);
+    void renderTexts(VisibilityLayer, const utils::FloatRect& viewArea,
+                     const utils::Vector2f& relativeOffset);
+    static bool canBeBatched(const RectangleShape&);
+    void addToSpriteBatch(const ShapeRenderingInfo&, const utils::Vector2f& relativeOffset);
+    SpriteBatch& getSpriteBatch(const sf::Texture*);
+    void drawSpriteBatches();
+    void updateShapePlacement(const GraphicsId&);
+    void applyTexture(ShapeRenderingInfo&, const TextureRegion&, const utils::Vector2f& scale);
+    void setUploadedTextures();
+    std::vector<ShapeWaitingForTexture>::iterator findShapeWaitingForTexture(const GraphicsId&);
+    GraphicsId acquireSlot(GraphicsKind);
+    const GraphicsSlot* findSlot(const GraphicsId&, GraphicsKind) const;
+    ShapeRenderingInfo* findLayeredShape(const GraphicsId&);
+    const ShapeRenderingInfo* findLayeredShape(const GraphicsId&) const;
+    TextRenderingInfo* findLayeredText(const GraphicsId&);
+    const TextRenderingInfo* findLayeredText(const GraphicsId&) const;
+    void removeLayeredShape(std::uint32_t slotIndex);
+    void removeLayeredText(std::uint32_t slotIndex);
     void cleanUnusedShapes();
-    std::vector<ShapeRenderingInfo>::const_iterator findLayeredShapePosition(const GraphicsId&) const;
-    std::vector<TextRenderingInfo>::const_iterator findLayeredTextPosition(const GraphicsId&) const;
 
     std::unique_ptr<ContextRenderer> contextRenderer;
     std::unique_ptr<TextureStorage> textureStorage;
     std::unique_ptr<FontStorage> fontStorage;
+    const RendererPoolSettings settings;
+    RenderingStatistics renderingStatistics;
+    std::vector<SpriteBatch> spriteBatches;
+    std::size_t numberOfUsedSpriteBatches;
     std::vector<ShapeRenderingInfo> layeredShapes;
     std::vector<TextRenderingInfo> layeredTexts;
-    std::unordered_set<GraphicsId, boost::hash<GraphicsId>> graphicsObjectsToRemove;
+    LayerBuckets shapesLayers;
+    LayerBuckets textsLayers;
+    std::vector<GraphicsSlot> slots;
+    std::vector<std::uint32_t> freeSlots;
+    std::vector<GraphicsId> graphicsObjectsToRemove;
+    GraphicsSpatialGrid shapesGrid;
+    std::vector<std::uint32_t> relativelyRenderedShapesSlots;
+    std::vector<std::uint32_t> shapesSlotsInView;
+    std::vector<std::uint32_t> shapesSlotsToRender;
+    StaticChunks staticChunks;
+    std::vector<ShapeWaitingForTexture> shapesWaitingForTextures;
 };
 }
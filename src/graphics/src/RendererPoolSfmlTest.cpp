@@ -7,6 +7,7 @@
 #include "FontStorageMock.h"
 #include "TextureStorageMock.h"
 
+#include "GraphicsIdGenerator.h"
 #include "RectangleShape.h"
 #include "exceptions/FontNotAvailable.h"
 #include "exceptions/TextureNotAvailable.h"
@@ -23,6 +24,7 @@ const utils::Vector2f newPosition{42, 42};
 const utils::Vector2f center{40, 30};
 const utils::Vector2f newCenter{30, 40};
 const utils::Vector2f viewSize{80, 60};
+const utils::Vector2f positionOutsideOfView{200, 200};
 const Color color{Color::Black};
 const TexturePath validTexturePath{"validTexturePath"};
 const TexturePath validTexturePath2{"validTexturePath2"};
@@ -46,7 +48,16 @@ public:
         EXPECT_CALL(*contextRenderer, setView());
     }
 
+    void expectRenderAll()
+    {
+        EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+        EXPECT_CALL(*contextRenderer, setView());
+        EXPECT_CALL(*contextRenderer, getCenter()).WillOnce(ReturnRef(center));
+        EXPECT_CALL(*contextRenderer, getViewSize()).WillOnce(ReturnRef(viewSize));
+    }
+
     sf::Texture texture;
+    const TextureRegion textureRegion{&texture, utils::IntRect{0, 0, 10, 10}};
     sf::Font font;
     std::unique_ptr<ContextRendererMock> contextRendererInit{
         std::make_unique<StrictMock<ContextRendererMock>>()};
@@ -61,6 +72,12 @@ public:
 class RendererPoolSfmlTest : public RendererPoolSfmlTest_Base
 {
 public:
+    void expectRenderAll(int numberOfDrawnGraphics)
+    {
+        RendererPoolSfmlTest_Base::expectRenderAll();
+        EXPECT_CALL(*contextRenderer, draw(_)).Times(numberOfDrawnGraphics);
+    }
+
     RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
                                   std::move(fontStorageInit)};
 };
@@ -76,7 +93,7 @@ TEST_F(RendererPoolSfmlTest, acquireShapeWithColor_positionShouldMatch)
 
 TEST_F(RendererPoolSfmlTest, acquireShapeWithTexture_textureNotAvailable_shouldThrowTextureNotAvailable)
 {
-    EXPECT_CALL(*textureStorage, getTexture(invalidTextureRect))
+    EXPECT_CALL(*textureStorage, getTextureRegion(invalidTextureRect))
         .WillOnce(Throw(exceptions::TextureNotAvailable{""}));
 
     ASSERT_THROW(rendererPool.acquire(size1, position, invalidTexturePath), exceptions::TextureNotAvailable);
@@ -84,7 +101,7 @@ TEST_F(RendererPoolSfmlTest, acquireShapeWithTexture_textureNotAvailable_shouldT
 
 TEST_F(RendererPoolSfmlTest, acquireShapeWithTexture_textureAvailable_positionShouldMatch)
 {
-    EXPECT_CALL(*textureStorage, getTexture(validTextureRect)).WillOnce(ReturnRef(texture));
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect)).WillOnce(ReturnRef(textureRegion));
 
     const auto shapeId = rendererPool.acquire(size1, position, validTexturePath);
 
@@ -275,6 +292,22 @@ TEST_F(RendererPoolSfmlTest, setVisibilityLayerToInvisibility_shuldNotRenderThis
     EXPECT_EQ(graphicsIds[0], backgroundGraphicsId);
 }
 
+TEST_F(RendererPoolSfmlTest, shapeMovedToOtherLayerAndBack_shouldBeRenderedOnTopOfItsLayer)
+{
+    const auto movedShapeId = rendererPool.acquire(size1, position, Color::Red, VisibilityLayer::First);
+    const auto shapeId = rendererPool.acquire(size1, position, Color::Red, VisibilityLayer::First);
+    rendererPool.setVisibility(movedShapeId, VisibilityLayer::Invisible);
+    rendererPool.setVisibility(movedShapeId, VisibilityLayer::First);
+    std::vector<GraphicsId> graphicsIds;
+    expectRenderAll(2);
+    ON_CALL(*contextRenderer, draw(_)).WillByDefault(addGraphicsIdToVector(&graphicsIds));
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedGraphicsIds{shapeId, movedShapeId};
+    ASSERT_EQ(graphicsIds, expectedGraphicsIds);
+}
+
 TEST_F(RendererPoolSfmlTest, renderTextsInLayers)
 {
     EXPECT_CALL(*fontStorage, getFont(validFontPath)).WillRepeatedly(ReturnRef(font));
@@ -416,7 +449,7 @@ TEST_F(RendererPoolSfmlTest, releasedText_shouldNotBeRendered)
 TEST_F(RendererPoolSfmlTest, setTextureWithValidTexturePath_shouldNoThrow)
 {
     const auto shapeId = rendererPool.acquire(size1, position, color);
-    EXPECT_CALL(*textureStorage, getTexture(validTextureRect2)).WillOnce(ReturnRef(texture));
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect2)).WillOnce(ReturnRef(textureRegion));
 
     ASSERT_NO_THROW(rendererPool.setTexture(shapeId, validTextureRect2));
 }
@@ -424,7 +457,7 @@ TEST_F(RendererPoolSfmlTest, setTextureWithValidTexturePath_shouldNoThrow)
 TEST_F(RendererPoolSfmlTest, setTextureWithInvalidTexturePath_shouldThrowTextureNotAvailable)
 {
     const auto shapeId = rendererPool.acquire(size1, position, color);
-    EXPECT_CALL(*textureStorage, getTexture(invalidTextureRect))
+    EXPECT_CALL(*textureStorage, getTextureRegion(invalidTextureRect))
         .WillOnce(Throw(exceptions::TextureNotAvailable{""}));
 
     ASSERT_THROW(rendererPool.setTexture(shapeId, invalidTextureRect), exceptions::TextureNotAvailable);
@@ -462,7 +495,7 @@ TEST_F(RendererPoolSfmlTest, synchronizeRenderingSize)
 
 TEST_F(RendererPoolSfmlTest, givenShape_getTextShouldReturnNone)
 {
-    EXPECT_CALL(*textureStorage, getTexture(validTextureRect)).WillOnce(ReturnRef(texture));
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect)).WillOnce(ReturnRef(textureRegion));
     const auto shapeId = rendererPool.acquire(size1, position, validTexturePath);
 
     const auto actualText = rendererPool.getText(shapeId);
@@ -514,6 +547,15 @@ TEST_F(RendererPoolSfmlTest, setSizeOfShapeShouldSetSize)
     ASSERT_EQ(rendererPool.getSize(shapeGraphicsId), size2);
 }
 
+TEST_F(RendererPoolSfmlTest, staticShapeWithoutBakedStaticShapes_shouldBeDrawnAsOtherShapes)
+{
+    const auto shapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.setStatic(shapeId);
+    expectRenderAll(1);
+
+    rendererPool.renderAll();
+}
+
 TEST_F(RendererPoolSfmlTest, setSizeOfTextShouldThrow)
 {
     EXPECT_CALL(*fontStorage, getFont(validFontPath)).WillOnce(ReturnRef(font));
@@ -522,4 +564,525 @@ TEST_F(RendererPoolSfmlTest, setSizeOfTextShouldThrow)
     rendererPool.setSize(textId, size2);
 
     ASSERT_THROW(rendererPool.getSize(textId), std::runtime_error);
+}
+TEST_F(RendererPoolSfmlTest, releasedShape_shouldNotBeAccessibleAfterRendering)
+{
+    const auto shapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.release(shapeId);
+    expectRenderAll(0);
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getPosition(shapeId), boost::none);
+}
+
+TEST_F(RendererPoolSfmlTest, shapeAcquiredAfterRelease_shouldNotBeAccessibleWithReleasedId)
+{
+    const auto releasedShapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.release(releasedShapeId);
+    expectRenderAll(0);
+    rendererPool.renderAll();
+
+    const auto shapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.setPosition(releasedShapeId, newPosition);
+
+    ASSERT_NE(shapeId, releasedShapeId);
+    ASSERT_EQ(shapeId.index, releasedShapeId.index);
+    ASSERT_EQ(rendererPool.getPosition(shapeId), position);
+}
+
+TEST_F(RendererPoolSfmlTest, graphicsReorderedByLayers_shouldStayAccessibleWithTheirIds)
+{
+    EXPECT_CALL(*fontStorage, getFont(validFontPath)).WillOnce(ReturnRef(font));
+    const auto firstLayerShapeId = rendererPool.acquire(size1, position, color, VisibilityLayer::First);
+    const auto releasedShapeId = rendererPool.acquire(size1, position, color, VisibilityLayer::Third);
+    const auto backgroundShapeId = rendererPool.acquire(size2, position, color, VisibilityLayer::Background);
+    const auto textId = rendererPool.acquireText(position, exampleText, validFontPath, characterSize);
+    rendererPool.setVisibility(firstLayerShapeId, VisibilityLayer::Second);
+    rendererPool.release(releasedShapeId);
+    expectRenderAll(3);
+    rendererPool.renderAll();
+
+    rendererPool.setPosition(firstLayerShapeId, newPosition);
+
+    ASSERT_EQ(rendererPool.getPosition(firstLayerShapeId), newPosition);
+    ASSERT_EQ(rendererPool.getSize(backgroundShapeId), size2);
+    ASSERT_EQ(rendererPool.getPosition(textId), position);
+}
+
+class RendererPoolSfmlWithBatchedRenderingTest : public RendererPoolSfmlTest_Base
+{
+public:
+    sf::Texture otherTexture;
+    const TextureRegion otherTextureRegion{&otherTexture, utils::IntRect{0, 0, 10, 10}};
+    RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
+                                  std::move(fontStorageInit), RendererPoolSettings{.batchedRendering = true}};
+};
+
+TEST_F(RendererPoolSfmlWithBatchedRenderingTest, shapesWithSameTextureInSameLayer_shouldBeDrawnTogether)
+{
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect)).WillRepeatedly(ReturnRef(textureRegion));
+    rendererPool.acquire(size1, position, validTexturePath);
+    rendererPool.acquire(size1, newPosition, validTexturePath);
+    rendererPool.acquire(size2, position, validTexturePath);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, &texture));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfDrawCalls, 1u);
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfVertices, 18u);
+}
+
+TEST_F(RendererPoolSfmlWithBatchedRenderingTest, shapesWithDifferentTextures_shouldBeDrawnInSeparateBatches)
+{
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect)).WillRepeatedly(ReturnRef(textureRegion));
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect2))
+        .WillRepeatedly(ReturnRef(otherTextureRegion));
+    rendererPool.acquire(size1, position, validTexturePath);
+    rendererPool.acquire(size1, newPosition, validTexturePath);
+    rendererPool.acquire(size1, position, validTexturePath2);
+    expectRenderAll();
+    InSequence drawingOrder;
+    EXPECT_CALL(*contextRenderer, draw(_, &texture));
+    EXPECT_CALL(*contextRenderer, draw(_, &otherTexture));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfDrawCalls, 2u);
+}
+
+TEST_F(RendererPoolSfmlWithBatchedRenderingTest,
+       shapeWithTextureOfEarlierBatch_shouldBeDrawnOnTopOfShapesAcquiredBeforeIt)
+{
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect)).WillRepeatedly(ReturnRef(textureRegion));
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect2))
+        .WillRepeatedly(ReturnRef(otherTextureRegion));
+    rendererPool.acquire(size1, position, validTexturePath);
+    rendererPool.acquire(size1, position, validTexturePath2);
+    rendererPool.acquire(size1, position, validTexturePath);
+    expectRenderAll();
+    InSequence drawingOrder;
+    EXPECT_CALL(*contextRenderer, draw(_, &texture));
+    EXPECT_CALL(*contextRenderer, draw(_, &otherTexture));
+    EXPECT_CALL(*contextRenderer, draw(_, &texture));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfDrawCalls, 3u);
+}
+
+TEST_F(RendererPoolSfmlWithBatchedRenderingTest, shapesInDifferentLayers_shouldBeDrawnInLayersOrder)
+{
+    rendererPool.acquire(size1, position, Color::Red, VisibilityLayer::First);
+    rendererPool.acquire(size1, position, Color::Green, VisibilityLayer::Background);
+    rendererPool.acquire(size1, position, Color::Blue, VisibilityLayer::Invisible);
+    std::vector<sf::Color> colorsOfBatches;
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, nullptr))
+        .Times(2)
+        .WillRepeatedly([&](const sf::VertexArray& vertices, const sf::Texture*)
+                        { colorsOfBatches.push_back(vertices[0].color); });
+
+    rendererPool.renderAll();
+
+    const std::vector<sf::Color> expectedColorsOfBatches{Color::Green, Color::Red};
+    ASSERT_EQ(colorsOfBatches, expectedColorsOfBatches);
+}
+
+TEST_F(RendererPoolSfmlWithBatchedRenderingTest, shapeVerticesShouldCoverShapeAndItsTextureRegion)
+{
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect)).WillOnce(ReturnRef(textureRegion));
+    rendererPool.acquire(size1, position, validTexturePath);
+    sf::VertexArray drawnVertices;
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, &texture)).WillOnce(SaveArg<0>(&drawnVertices));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(drawnVertices.getVertexCount(), 6u);
+    ASSERT_EQ(drawnVertices[0].position, position);
+    ASSERT_EQ(drawnVertices[5].position, position + size1);
+    ASSERT_EQ(drawnVertices[0].texCoords, utils::Vector2f(0, 0));
+    ASSERT_EQ(drawnVertices[5].texCoords, utils::Vector2f(10, 10));
+}
+
+TEST_F(RendererPoolSfmlWithBatchedRenderingTest, shapeWithOutlineAndTexts_shouldBeDrawnSeparately)
+{
+    EXPECT_CALL(*fontStorage, getFont(validFontPath)).WillOnce(ReturnRef(font));
+    rendererPool.acquire(size1, position, color);
+    const auto outlinedShapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.setOutline(outlinedShapeId, 0.2f, Color::Red);
+    rendererPool.acquireText(position, exampleText, validFontPath, characterSize);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, nullptr));
+    EXPECT_CALL(*contextRenderer, draw(_)).Times(2);
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfDrawCalls, 3u);
+}
+
+class RendererPoolSfmlWithViewCullingTest : public RendererPoolSfmlTest_Base
+{
+public:
+    void expectRenderAll(std::vector<GraphicsId>& drawnGraphicsIds)
+    {
+        RendererPoolSfmlTest_Base::expectRenderAll();
+        EXPECT_CALL(*contextRenderer, draw(_)).WillRepeatedly(addGraphicsIdToVector(&drawnGraphicsIds));
+    }
+
+    RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
+                                  std::move(fontStorageInit), RendererPoolSettings{.viewCulling = true}};
+};
+
+TEST_F(RendererPoolSfmlWithViewCullingTest, shapeOutsideOfView_shouldNotBeRendered)
+{
+    const auto shapeInViewId = rendererPool.acquire(size1, position, color);
+    rendererPool.acquire(size1, positionOutsideOfView, color);
+    std::vector<GraphicsId> drawnGraphicsIds;
+    expectRenderAll(drawnGraphicsIds);
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedDrawnGraphicsIds{shapeInViewId};
+    ASSERT_EQ(drawnGraphicsIds, expectedDrawnGraphicsIds);
+}
+
+TEST_F(RendererPoolSfmlWithViewCullingTest, shapeMovedIntoView_shouldBeRendered)
+{
+    const auto shapeId = rendererPool.acquire(size1, positionOutsideOfView, color);
+    rendererPool.setPosition(shapeId, newPosition);
+    std::vector<GraphicsId> drawnGraphicsIds;
+    expectRenderAll(drawnGraphicsIds);
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedDrawnGraphicsIds{shapeId};
+    ASSERT_EQ(drawnGraphicsIds, expectedDrawnGraphicsIds);
+}
+
+TEST_F(RendererPoolSfmlWithViewCullingTest, shapeResizedIntoView_shouldBeRendered)
+{
+    const auto shapeId = rendererPool.acquire(size1, utils::Vector2f{-50, 10}, color);
+    rendererPool.setSize(shapeId, size2);
+    std::vector<GraphicsId> drawnGraphicsIds;
+    expectRenderAll(drawnGraphicsIds);
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedDrawnGraphicsIds{shapeId};
+    ASSERT_EQ(drawnGraphicsIds, expectedDrawnGraphicsIds);
+}
+
+TEST_F(RendererPoolSfmlWithViewCullingTest, relativelyRenderedShapeOutsideOfView_shouldBeRendered)
+{
+    const auto shapeId =
+        rendererPool.acquire(size1, positionOutsideOfView, color, VisibilityLayer::First, true);
+    std::vector<GraphicsId> drawnGraphicsIds;
+    expectRenderAll(drawnGraphicsIds);
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedDrawnGraphicsIds{shapeId};
+    ASSERT_EQ(drawnGraphicsIds, expectedDrawnGraphicsIds);
+}
+
+TEST_F(RendererPoolSfmlWithViewCullingTest, shapesInView_shouldBeRenderedInLayersOrder)
+{
+    const auto firstLayerShapeId = rendererPool.acquire(size1, position, color, VisibilityLayer::First);
+    const auto backgroundShapeId = rendererPool.acquire(size2, position, color, VisibilityLayer::Background);
+    rendererPool.acquire(size1, positionOutsideOfView, color, VisibilityLayer::Second);
+    std::vector<GraphicsId> drawnGraphicsIds;
+    expectRenderAll(drawnGraphicsIds);
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedDrawnGraphicsIds{backgroundShapeId, firstLayerShapeId};
+    ASSERT_EQ(drawnGraphicsIds, expectedDrawnGraphicsIds);
+}
+
+TEST_F(RendererPoolSfmlWithViewCullingTest, releasedShape_shouldNotBeRendered)
+{
+    const auto releasedShapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.release(releasedShapeId);
+    const auto shapeId = rendererPool.acquire(size1, newPosition, color);
+    std::vector<GraphicsId> drawnGraphicsIds;
+    expectRenderAll(drawnGraphicsIds);
+
+    rendererPool.renderAll();
+
+    const std::vector<GraphicsId> expectedDrawnGraphicsIds{shapeId};
+    ASSERT_EQ(drawnGraphicsIds, expectedDrawnGraphicsIds);
+}
+
+class RendererPoolSfmlWithBakedStaticShapesTest : public RendererPoolSfmlTest_Base
+{
+public:
+    void expectRenderAll()
+    {
+        RendererPoolSfmlTest_Base::expectRenderAll();
+        EXPECT_CALL(*contextRenderer, getPixelsPerUnit()).WillOnce(Return(pixelsPerUnit));
+    }
+
+    GraphicsId acquireStaticShape(const utils::Vector2f& shapePosition,
+                                  VisibilityLayer layer = VisibilityLayer::First)
+    {
+        const auto shapeId = rendererPool.acquire(size1, shapePosition, color, layer);
+        rendererPool.setStatic(shapeId);
+        return shapeId;
+    }
+
+    const utils::Vector2f positionInOtherChunk{70, 10};
+    const float pixelsPerUnit{10.f};
+    RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
+                                  std::move(fontStorageInit),
+                                  RendererPoolSettings{.bakedStaticShapes = true}};
+};
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, staticShapesFromOneChunk_shouldBeDrawnWithOneDrawCall)
+{
+    acquireStaticShape(position);
+    acquireStaticShape(newPosition);
+    rendererPool.acquire(size1, position, color);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfDrawCalls, 2u);
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfBakedChunks, 1u);
+}
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, chunkVerticesShouldCoverWholeChunkInResolutionOfView)
+{
+    acquireStaticShape(position);
+    sf::VertexArray drawnVertices;
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull())).WillOnce(SaveArg<0>(&drawnVertices));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(drawnVertices.getVertexCount(), 6u);
+    ASSERT_EQ(drawnVertices[0].position, utils::Vector2f(0, 0));
+    ASSERT_EQ(drawnVertices[5].position, utils::Vector2f(64, 64));
+    ASSERT_EQ(drawnVertices[5].texCoords, utils::Vector2f(640, 640));
+}
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, staticShapesFromDifferentChunks_shouldBeDrawnSeparately)
+{
+    acquireStaticShape(position);
+    acquireStaticShape(positionInOtherChunk);
+    acquireStaticShape(positionOutsideOfView);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull())).Times(2);
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfBakedChunks, 2u);
+}
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, unchangedStaticShapes_shouldBeBakedOnlyOnce)
+{
+    const auto shapeId = acquireStaticShape(position);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+    rendererPool.renderAll();
+    rendererPool.setPosition(shapeId, position);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfBakedChunks, 0u);
+}
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, addedAndReleasedStaticShapes_shouldBakeTheirChunksAgain)
+{
+    const auto shapeId = acquireStaticShape(position);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+    rendererPool.renderAll();
+    rendererPool.release(shapeId);
+    acquireStaticShape(positionInOtherChunk);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfBakedChunks, 1u);
+}
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, staticAndOtherShapes_shouldBeDrawnInLayersOrder)
+{
+    acquireStaticShape(position, VisibilityLayer::Second);
+    rendererPool.acquire(size1, position, color, VisibilityLayer::Background);
+    rendererPool.acquire(size1, position, color, VisibilityLayer::First);
+    acquireStaticShape(position, VisibilityLayer::Invisible);
+    expectRenderAll();
+    InSequence drawingOrder;
+    EXPECT_CALL(*contextRenderer, draw(_));
+    EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlWithBakedStaticShapesTest, relativelyRenderedShape_shouldNotBeBaked)
+{
+    const auto shapeId = rendererPool.acquire(size1, position, color, VisibilityLayer::First, true);
+    rendererPool.setStatic(shapeId);
+    expectRenderAll();
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+}
+
+class RendererPoolSfmlWithAsynchronousTextureLoadingTest : public RendererPoolSfmlTest_Base
+{
+public:
+    void expectDrawnShape(const sf::Color& fillColor, const sf::Texture* shapeTexture)
+    {
+        EXPECT_CALL(*contextRenderer, draw(Truly(
+                                          [=](const sf::Drawable& drawable)
+                                          {
+                                              const auto& shape = dynamic_cast<const sf::Shape&>(drawable);
+                                              return shape.getFillColor() == fillColor and
+                                                     shape.getTexture() == shapeTexture;
+                                          })));
+    }
+
+    sf::Texture texture2;
+    const TextureRegion textureRegion2{&texture2, utils::IntRect{0, 0, 10, 10}};
+    const std::chrono::microseconds uploadTimeBudget{1000};
+    RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
+                                  std::move(fontStorageInit),
+                                  RendererPoolSettings{.asynchronousTextureLoading = true,
+                                                       .textureUploadTimeBudget = uploadTimeBudget}};
+};
+
+TEST_F(RendererPoolSfmlWithAsynchronousTextureLoadingTest, shapeWithTextureBeingLoaded_shouldBeTransparent)
+{
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect)).WillRepeatedly(Return(nullptr));
+    rendererPool.acquire(size1, position, validTexturePath);
+    expectRenderAll();
+    EXPECT_CALL(*textureStorage, uploadLoadedTextures(uploadTimeBudget));
+    expectDrawnShape(Color::Transparent, nullptr);
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlWithAsynchronousTextureLoadingTest,
+       shapeWithUploadedTexture_shouldBeDrawnWithItsTextureAndColor)
+{
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect))
+        .WillOnce(Return(nullptr))
+        .WillOnce(Return(&textureRegion));
+    rendererPool.acquire(size1, position, validTexturePath);
+    expectRenderAll();
+    EXPECT_CALL(*textureStorage, uploadLoadedTextures(uploadTimeBudget));
+    expectDrawnShape(Color::White, &texture);
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlWithAsynchronousTextureLoadingTest,
+       shapeWaitingForNextTexture_shouldBeDrawnWithPreviousTexture)
+{
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect)).WillOnce(Return(&textureRegion));
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect2)).WillRepeatedly(Return(nullptr));
+    const auto shapeId = rendererPool.acquire(size1, position, validTexturePath);
+    rendererPool.setTexture(shapeId, validTextureRect2);
+    expectRenderAll();
+    EXPECT_CALL(*textureStorage, uploadLoadedTextures(uploadTimeBudget));
+    expectDrawnShape(Color::White, &texture);
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlWithAsynchronousTextureLoadingTest, shapeWithUnavailableTexture_shouldGetItsColorBack)
+{
+    EXPECT_CALL(*textureStorage, requestTextureRegion(invalidTextureRect))
+        .WillOnce(Return(nullptr))
+        .WillOnce(Throw(exceptions::TextureNotAvailable{""}));
+    const auto shapeId = rendererPool.acquire(size1, position, invalidTexturePath);
+    rendererPool.setColor(shapeId, color);
+    expectRenderAll();
+    EXPECT_CALL(*textureStorage, uploadLoadedTextures(uploadTimeBudget));
+    expectDrawnShape(color, nullptr);
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlWithAsynchronousTextureLoadingTest, waitForTextures_shouldSetTexturesOfWaitingShapes)
+{
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect)).WillOnce(Return(nullptr));
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect2)).WillOnce(Return(nullptr));
+    const auto shapeId = rendererPool.acquire(size1, position, validTexturePath);
+    rendererPool.setTexture(shapeId, validTextureRect2);
+    EXPECT_CALL(*textureStorage, getTextureRegion(validTextureRect2)).WillOnce(ReturnRef(textureRegion2));
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect2)).WillOnce(Return(&textureRegion2));
+    rendererPool.waitForTextures();
+    expectRenderAll();
+    expectDrawnShape(Color::White, &texture2);
+
+    rendererPool.renderAll();
+}
+
+class RendererPoolSfmlWithAllSettingsTest : public RendererPoolSfmlTest_Base
+{
+public:
+    void expectRenderAll()
+    {
+        RendererPoolSfmlTest_Base::expectRenderAll();
+        EXPECT_CALL(*contextRenderer, getPixelsPerUnit()).WillOnce(Return(pixelsPerUnit));
+    }
+
+    const float pixelsPerUnit{10.f};
+    const std::chrono::microseconds uploadTimeBudget{1000};
+    RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
+                                  std::move(fontStorageInit),
+                                  RendererPoolSettings{.batchedRendering = true,
+                                                       .viewCulling = true,
+                                                       .bakedStaticShapes = true,
+                                                       .asynchronousTextureLoading = true,
+                                                       .textureUploadTimeBudget = uploadTimeBudget}};
+};
+
+TEST_F(RendererPoolSfmlWithAllSettingsTest,
+       shapesInView_shouldBeDrawnAsBakedChunkAndBatchesWithPlaceholdersForTexturesBeingLoaded)
+{
+    const auto staticShapeId = rendererPool.acquire(size1, position, color);
+    rendererPool.setStatic(staticShapeId);
+    EXPECT_CALL(*textureStorage, requestTextureRegion(validTextureRect))
+        .WillOnce(Return(nullptr))
+        .WillOnce(Return(nullptr))
+        .WillOnce(Return(&textureRegion));
+    rendererPool.acquire(size1, newPosition, validTexturePath);
+    rendererPool.acquire(size1, positionOutsideOfView, color, VisibilityLayer::Second);
+    sf::VertexArray placeholderVertices;
+    expectRenderAll();
+    EXPECT_CALL(*textureStorage, uploadLoadedTextures(uploadTimeBudget)).Times(2);
+    {
+        InSequence drawingOrder;
+        EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+        EXPECT_CALL(*contextRenderer, draw(_, nullptr)).WillOnce(SaveArg<0>(&placeholderVertices));
+    }
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(placeholderVertices[0].color, Color::Transparent);
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfDrawCalls, 2u);
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfBakedChunks, 1u);
+    expectRenderAll();
+    {
+        InSequence drawingOrder;
+        EXPECT_CALL(*contextRenderer, draw(_, NotNull()));
+        EXPECT_CALL(*contextRenderer, draw(_, &texture));
+    }
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getRenderingStatistics().numberOfBakedChunks, 0u);
 }
\ No newline at end of file
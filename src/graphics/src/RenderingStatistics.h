@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+namespace graphics
+{
+// counted for last rendered frame, vertices are counted only for batched shapes
+struct RenderingStatistics
+{
+    std::size_t numberOfDrawCalls{0};
+    std::size_t numberOfVertices{0};
+    std::size_t numberOfBakedChunks{0};
+};
+}
\ No newline at end of file
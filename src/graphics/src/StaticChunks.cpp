@@ -0,0 +1,234 @@
+#include "StaticChunks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "SFML/Graphics/View.hpp"
+
+namespace graphics
+{
+
+StaticChunks::StaticChunks(float chunkSizeInit, unsigned maxChunkTextureSizeInit, ShapeProvider shapeProvider,
+                           OrderProvider orderProvider)
+    : chunkSize{chunkSizeInit},
+      maxChunkTextureSize{maxChunkTextureSizeInit},
+      chunkTextureSize{maxChunkTextureSizeInit},
+      getShape{std::move(shapeProvider)},
+      getOrder{std::move(orderProvider)},
+      chunkVertices{sf::Triangles, 6}
+{
+}
+
+void StaticChunks::setPixelsPerUnit(float pixelsPerUnit)
+{
+    const auto textureSize = std::clamp(static_cast<unsigned>(std::ceil(chunkSize * pixelsPerUnit)), 1u,
+                                        maxChunkTextureSize);
+
+    if (textureSize == chunkTextureSize)
+    {
+        return;
+    }
+
+    chunkTextureSize = textureSize;
+
+    for (auto& [key, chunk] : chunks)
+    {
+        chunk.texture.reset();
+        chunk.needsBaking = true;
+    }
+}
+
+void StaticChunks::insertOrUpdate(std::uint32_t slotIndex, VisibilityLayer layer,
+                                  const utils::FloatRect& bounds)
+{
+    if (slotIndex >= placementsOfShapes.size())
+    {
+        placementsOfShapes.resize(slotIndex + 1);
+    }
+
+    auto& placement = placementsOfShapes[slotIndex];
+    const ShapePlacement newPlacement{layer, getChunkRange(bounds)};
+
+    // chunks which shape does not leave keep their textures and its order among their shapes
+    if (placement)
+    {
+        removeFromChunks(slotIndex, *placement, newPlacement);
+    }
+
+    placement = newPlacement;
+    addToChunks(slotIndex, *placement);
+}
+
+void StaticChunks::remove(std::uint32_t slotIndex)
+{
+    if (not contains(slotIndex))
+    {
+        return;
+    }
+
+    removeFromChunks(slotIndex, *placementsOfShapes[slotIndex]);
+    placementsOfShapes[slotIndex].reset();
+}
+
+bool StaticChunks::contains(std::uint32_t slotIndex) const
+{
+    return slotIndex < placementsOfShapes.size() and placementsOfShapes[slotIndex].has_value();
+}
+
+std::size_t StaticChunks::getNumberOfChunks() const
+{
+    return chunks.size();
+}
+
+void StaticChunks::render(VisibilityLayer layer, const utils::FloatRect& viewArea,
+                          ContextRenderer& contextRenderer, RenderingStatistics& renderingStatistics)
+{
+    const auto chunksOfView = getChunkRange(viewArea);
+
+    for (int column = chunksOfView.firstColumn; column <= chunksOfView.lastColumn; column++)
+    {
+        // chunks of one column are neighbours in map ordered by layer, column and row
+        const auto firstChunk = chunks.lower_bound({layer, column, chunksOfView.firstRow});
+        const auto endChunk = chunks.upper_bound({layer, column, chunksOfView.lastRow});
+
+        for (auto chunk = firstChunk; chunk != endChunk; chunk++)
+        {
+            auto& [key, chunkToRender] = *chunk;
+            const auto row = std::get<2>(key);
+
+            if (chunkToRender.needsBaking)
+            {
+                bake(chunkToRender, column, row);
+                renderingStatistics.numberOfBakedChunks++;
+            }
+
+            setChunkVertices(column, row);
+            contextRenderer.draw(chunkVertices, &chunkToRender.texture->getTexture());
+            renderingStatistics.numberOfDrawCalls++;
+            renderingStatistics.numberOfVertices += chunkVertices.getVertexCount();
+        }
+    }
+}
+
+StaticChunks::ChunkRange StaticChunks::getChunkRange(const utils::FloatRect& area) const
+{
+    const auto firstColumn = static_cast<int>(std::floor(area.left / chunkSize));
+    const auto lastColumn =
+        std::max(firstColumn, static_cast<int>(std::ceil((area.left + area.width) / chunkSize)) - 1);
+    const auto firstRow = static_cast<int>(std::floor(area.top / chunkSize));
+    const auto lastRow =
+        std::max(firstRow, static_cast<int>(std::ceil((area.top + area.height) / chunkSize)) - 1);
+
+    return {firstColumn, lastColumn, firstRow, lastRow};
+}
+
+bool StaticChunks::isInChunk(const ShapePlacement& placement, VisibilityLayer layer, int column, int row)
+{
+    const auto& chunksOfShape = placement.chunksOfShape;
+    return placement.layer == layer and column >= chunksOfShape.firstColumn and
+           column <= chunksOfShape.lastColumn and row >= chunksOfShape.firstRow and
+           row <= chunksOfShape.lastRow;
+}
+
+void StaticChunks::addToChunks(std::uint32_t slotIndex, const ShapePlacement& placement)
+{
+    if (placement.layer == VisibilityLayer::Invisible)
+    {
+        return;
+    }
+
+    const auto& chunksOfShape = placement.chunksOfShape;
+
+    for (int column = chunksOfShape.firstColumn; column <= chunksOfShape.lastColumn; column++)
+    {
+        for (int row = chunksOfShape.firstRow; row <= chunksOfShape.lastRow; row++)
+        {
+            auto& chunk = chunks[{placement.layer, column, row}];
+            const auto shapeSlot =
+                std::lower_bound(chunk.shapesSlots.begin(), chunk.shapesSlots.end(), slotIndex,
+                                 [this](std::uint32_t lhs, std::uint32_t rhs)
+                                 { return getOrder(lhs) < getOrder(rhs); });
+
+            if (shapeSlot == chunk.shapesSlots.end() or *shapeSlot != slotIndex)
+            {
+                chunk.shapesSlots.insert(shapeSlot, slotIndex);
+            }
+
+            chunk.needsBaking = true;
+        }
+    }
+}
+
+void StaticChunks::removeFromChunks(std::uint32_t slotIndex, const ShapePlacement& placement,
+                                    const std::optional<ShapePlacement>& placementToKeep)
+{
+    if (placement.layer == VisibilityLayer::Invisible)
+    {
+        return;
+    }
+
+    const auto& chunksOfShape = placement.chunksOfShape;
+
+    for (int column = chunksOfShape.firstColumn; column <= chunksOfShape.lastColumn; column++)
+    {
+        for (int row = chunksOfShape.firstRow; row <= chunksOfShape.lastRow; row++)
+        {
+            if (placementToKeep and isInChunk(*placementToKeep, placement.layer, column, row))
+            {
+                continue;
+            }
+
+            const auto chunk = chunks.find({placement.layer, column, row});
+            std::erase(chunk->second.shapesSlots, slotIndex);
+            chunk->second.needsBaking = true;
+
+            // empty chunk is dropped together with its texture
+            if (chunk->second.shapesSlots.empty())
+            {
+                chunks.erase(chunk);
+            }
+        }
+    }
+}
+
+void StaticChunks::bake(Chunk& chunk, int column, int row)
+{
+    if (not chunk.texture)
+    {
+        chunk.texture = std::make_unique<sf::RenderTexture>();
+        chunk.texture->create(chunkTextureSize, chunkTextureSize);
+    }
+
+    const utils::FloatRect chunkArea{static_cast<float>(column) * chunkSize,
+                                     static_cast<float>(row) * chunkSize, chunkSize, chunkSize};
+    chunk.texture->setView(sf::View{chunkArea});
+    chunk.texture->clear(sf::Color::Transparent);
+
+    // shapes overlapping several chunks are clipped by each of them
+    for (const auto slotIndex : chunk.shapesSlots)
+    {
+        chunk.texture->draw(getShape(slotIndex));
+    }
+
+    chunk.texture->display();
+    chunk.needsBaking = false;
+}
+
+void StaticChunks::setChunkVertices(int column, int row)
+{
+    const auto left = static_cast<float>(column) * chunkSize;
+    const auto top = static_cast<float>(row) * chunkSize;
+    const auto right = left + chunkSize;
+    const auto bottom = top + chunkSize;
+    const auto textureSize = static_cast<float>(chunkTextureSize);
+
+    chunkVertices[0] = sf::Vertex{{left, top}, {0, 0}};
+    chunkVertices[1] = sf::Vertex{{right, top}, {textureSize, 0}};
+    chunkVertices[2] = sf::Vertex{{left, bottom}, {0, textureSize}};
+    chunkVertices[3] = sf::Vertex{{left, bottom}, {0, textureSize}};
+    chunkVertices[4] = sf::Vertex{{right, top}, {textureSize, 0}};
+    chunkVertices[5] = sf::Vertex{{right, bottom}, {textureSize, textureSize}};
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/VertexArray.hpp"
+
+#include "ContextRenderer.h"
+#include "Rect.h"
+#include "RectangleShape.h"
+#include "RenderingStatistics.h"
+#include "VisibilityLayer.h"
+
+namespace graphics
+{
+// static shapes are baked into textures of square chunks, chunk is baked again only after its shapes change
+class StaticChunks
+{
+public:
+    using ShapeProvider = std::function<const RectangleShape&(std::uint32_t slotIndex)>;
+    // shapes of chunk are baked in order of their layer
+    using OrderProvider = std::function<std::size_t(std::uint32_t slotIndex)>;
+
+    StaticChunks(float chunkSize, unsigned maxChunkTextureSize, ShapeProvider, OrderProvider);
+
+    // chunks are baked again when resolution of their textures changes
+    void setPixelsPerUnit(float);
+
+    void insertOrUpdate(std::uint32_t slotIndex, VisibilityLayer, const utils::FloatRect& bounds);
+    void remove(std::uint32_t slotIndex);
+    bool contains(std::uint32_t slotIndex) const;
+    std::size_t getNumberOfChunks() const;
+    void render(VisibilityLayer, const utils::FloatRect& viewArea, ContextRenderer&, RenderingStatistics&);
+
+private:
+    struct ChunkRange
+    {
+        int firstColumn;
+        int lastColumn;
+        int firstRow;
+        int lastRow;
+    };
+
+    struct ShapePlacement
+    {
+        VisibilityLayer layer;
+        ChunkRange chunksOfShape;
+    };
+
+    struct Chunk
+    {
+        std::vector<std::uint32_t> shapesSlots;
+        std::unique_ptr<sf::RenderTexture> texture;
+        bool needsBaking{true};
+    };
+
+    using ChunkKey = std::tuple<VisibilityLayer, int, int>;
+
+    ChunkRange getChunkRange(const utils::FloatRect& area) const;
+    static bool isInChunk(const ShapePlacement&, VisibilityLayer, int column, int row);
+    void addToChunks(std::uint32_t slotIndex, const ShapePlacement&);
+    void removeFromChunks(std::uint32_t slotIndex, const ShapePlacement&,
+                          const std::optional<ShapePlacement>& placementToKeep = std::nullopt);
+    void bake(Chunk&, int column, int row);
+    void setChunkVertices(int column, int row);
+
+    const float chunkSize;
+    const unsigned maxChunkTextureSize;
+    unsigned chunkTextureSize;
+    ShapeProvider getShape;
+    OrderProvider getOrder;
+    std::map<ChunkKey, Chunk> chunks;
+    std::vector<std::optional<ShapePlacement>> placementsOfShapes;
+    sf::VertexArray chunkVertices;
+};
+}
\ No newline at end of file
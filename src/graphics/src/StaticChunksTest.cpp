@@ -0,0 +1,179 @@
+#include "StaticChunks.h"
+
+#include "gtest/gtest.h"
+
+#include "ContextRendererMock.h"
+
+#include "GraphicsIdGenerator.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+namespace
+{
+const utils::FloatRect viewArea{0, 0, 80, 60};
+const utils::FloatRect boundsInsideOfView{10, 10, 4, 4};
+const utils::FloatRect boundsOutsideOfView{200, 10, 4, 4};
+const utils::FloatRect boundsCoveringTwoChunks{60, 10, 8, 4};
+const std::uint32_t slotIndex{0};
+const std::uint32_t otherSlotIndex{1};
+}
+
+class StaticChunksTest : public Test
+{
+public:
+    void render(VisibilityLayer layer = VisibilityLayer::First)
+    {
+        renderingStatistics = {};
+        staticChunks.render(layer, viewArea, contextRenderer, renderingStatistics);
+    }
+
+    const RectangleShape shape{GraphicsIdGenerator::generateId(), {4, 4}, {10, 10}, Color::Red};
+    StrictMock<ContextRendererMock> contextRenderer;
+    RenderingStatistics renderingStatistics;
+    std::vector<std::uint32_t> bakedSlots;
+    StaticChunks staticChunks{64.f, 2048,
+                              [this](std::uint32_t bakedSlot) -> const RectangleShape&
+                              {
+                                  bakedSlots.push_back(bakedSlot);
+                                  return shape;
+                              },
+                              [](std::uint32_t slot) -> std::size_t { return slot; }};
+};
+
+TEST_F(StaticChunksTest, insertedShape_shouldBeContained)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+
+    ASSERT_TRUE(staticChunks.contains(slotIndex));
+    ASSERT_FALSE(staticChunks.contains(otherSlotIndex));
+}
+
+TEST_F(StaticChunksTest, removedShape_shouldNotBeContained)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+
+    staticChunks.remove(slotIndex);
+
+    ASSERT_FALSE(staticChunks.contains(slotIndex));
+}
+
+TEST_F(StaticChunksTest, chunksOfOtherLayerOrOutsideOfView_shouldNotBeRendered)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::Second, boundsInsideOfView);
+    staticChunks.insertOrUpdate(otherSlotIndex, VisibilityLayer::First, boundsOutsideOfView);
+
+    render();
+
+    ASSERT_EQ(renderingStatistics.numberOfDrawCalls, 0u);
+}
+
+TEST_F(StaticChunksTest, shapeCoveringTwoChunks_shouldBeBakedIntoBothOfThem)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsCoveringTwoChunks);
+    EXPECT_CALL(contextRenderer, draw(_, NotNull())).Times(2);
+
+    render();
+
+    ASSERT_EQ(renderingStatistics.numberOfBakedChunks, 2u);
+}
+
+TEST_F(StaticChunksTest, movedShape_shouldBakeOnlyChunksItLeftAndEntered)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    staticChunks.insertOrUpdate(otherSlotIndex, VisibilityLayer::First, boundsCoveringTwoChunks);
+    EXPECT_CALL(contextRenderer, draw(_, NotNull())).Times(3);
+    render();
+
+    staticChunks.insertOrUpdate(otherSlotIndex, VisibilityLayer::First, boundsInsideOfView);
+    render();
+
+    ASSERT_EQ(renderingStatistics.numberOfBakedChunks, 1u);
+}
+
+TEST_F(StaticChunksTest, shapeMovedToInvisibleLayer_shouldLeaveItsChunks)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::Invisible, boundsInsideOfView);
+    render();
+
+    ASSERT_TRUE(staticChunks.contains(slotIndex));
+    ASSERT_EQ(renderingStatistics.numberOfDrawCalls, 0u);
+}
+
+TEST_F(StaticChunksTest, chunkTexture_shouldHaveResolutionOfView)
+{
+    staticChunks.setPixelsPerUnit(10.f);
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    sf::VertexArray drawnVertices;
+    EXPECT_CALL(contextRenderer, draw(_, NotNull())).WillOnce(SaveArg<0>(&drawnVertices));
+
+    render();
+
+    ASSERT_EQ(drawnVertices[5].texCoords, utils::Vector2f(640, 640));
+}
+
+TEST_F(StaticChunksTest, chunkTextureResolution_shouldBeLimitedByMaxTextureSize)
+{
+    staticChunks.setPixelsPerUnit(100.f);
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    sf::VertexArray drawnVertices;
+    EXPECT_CALL(contextRenderer, draw(_, NotNull())).WillOnce(SaveArg<0>(&drawnVertices));
+
+    render();
+
+    ASSERT_EQ(drawnVertices[5].texCoords, utils::Vector2f(2048, 2048));
+}
+
+TEST_F(StaticChunksTest, changedResolutionOfView_shouldBakeChunksAgain)
+{
+    staticChunks.setPixelsPerUnit(10.f);
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    EXPECT_CALL(contextRenderer, draw(_, NotNull())).Times(3);
+    render();
+
+    staticChunks.setPixelsPerUnit(10.f);
+    render();
+    ASSERT_EQ(renderingStatistics.numberOfBakedChunks, 0u);
+
+    staticChunks.setPixelsPerUnit(20.f);
+    render();
+    ASSERT_EQ(renderingStatistics.numberOfBakedChunks, 1u);
+}
+
+TEST_F(StaticChunksTest, shapesOfChunk_shouldBeBakedInOrderOfLayer)
+{
+    staticChunks.insertOrUpdate(otherSlotIndex, VisibilityLayer::First, boundsInsideOfView);
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    EXPECT_CALL(contextRenderer, draw(_, NotNull()));
+
+    render();
+
+    const std::vector<std::uint32_t> expectedBakedSlots{slotIndex, otherSlotIndex};
+    ASSERT_EQ(bakedSlots, expectedBakedSlots);
+}
+
+TEST_F(StaticChunksTest, updatedShape_shouldKeepItsOrderInChunk)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    staticChunks.insertOrUpdate(otherSlotIndex, VisibilityLayer::First, boundsCoveringTwoChunks);
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsCoveringTwoChunks);
+    EXPECT_CALL(contextRenderer, draw(_, NotNull())).Times(2);
+
+    render();
+
+    const std::vector<std::uint32_t> expectedBakedSlots{slotIndex, otherSlotIndex, slotIndex, otherSlotIndex};
+    ASSERT_EQ(bakedSlots, expectedBakedSlots);
+}
+
+TEST_F(StaticChunksTest, chunksLeftByAllShapes_shouldBeDropped)
+{
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsCoveringTwoChunks);
+    staticChunks.insertOrUpdate(otherSlotIndex, VisibilityLayer::Second, boundsInsideOfView);
+
+    staticChunks.insertOrUpdate(slotIndex, VisibilityLayer::First, boundsInsideOfView);
+    staticChunks.remove(otherSlotIndex);
+
+    ASSERT_EQ(staticChunks.getNumberOfChunks(), 1u);
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+
+namespace graphics
+{
+namespace
+{
+// keeps neighbouring regions from bleeding into each other when shapes are scaled
+const unsigned regionsSpacing{1};
+}
+
+TextureAtlas::TextureAtlas(unsigned pageSizeInit) : pageSize{pageSizeInit} {}
+
+TextureRegion TextureAtlas::add(const sf::Image& image, const utils::IntRect& rectToCut)
+{
+    const auto width = static_cast<unsigned>(rectToCut.width);
+    const auto height = static_cast<unsigned>(rectToCut.height);
+
+    sf::Image region;
+    region.create(width, height);
+    region.copy(image, 0, 0, rectToCut);
+
+    auto [page, regionPosition] = reserveRegion(width, height);
+    page.texture->update(region, regionPosition.x, regionPosition.y);
+
+    return {page.texture.get(),
+            utils::IntRect{static_cast<int>(regionPosition.x), static_cast<int>(regionPosition.y),
+                           rectToCut.width, rectToCut.height}};
+}
+
+std::size_t TextureAtlas::getNumberOfPages() const
+{
+    return pages.size();
+}
+
+std::pair<TextureAtlas::Page&, utils::Vector2u> TextureAtlas::reserveRegion(unsigned width, unsigned height)
+{
+    for (auto& page : pages)
+    {
+        if (const auto regionPosition = reserveRegionInPage(page, width, height))
+        {
+            return {page, *regionPosition};
+        }
+    }
+
+    auto& page = createPage(std::max(pageSize, width), std::max(pageSize, height));
+    return {page, *reserveRegionInPage(page, width, height)};
+}
+
+std::optional<utils::Vector2u> TextureAtlas::reserveRegionInPage(Page& page, unsigned width, unsigned height)
+{
+    const auto pageTextureSize = page.texture->getSize();
+    auto rowLeft = page.rowLeft;
+    auto rowTop = page.rowTop;
+    auto rowHeight = page.rowHeight;
+
+    if (rowLeft + width > pageTextureSize.x)
+    {
+        rowLeft = 0;
+        rowTop += rowHeight + regionsSpacing;
+        rowHeight = 0;
+    }
+
+    if (rowLeft + width > pageTextureSize.x or rowTop + height > pageTextureSize.y)
+    {
+        return std::nullopt;
+    }
+
+    page.rowLeft = rowLeft + width + regionsSpacing;
+    page.rowTop = rowTop;
+    page.rowHeight = std::max(rowHeight, height);
+    return utils::Vector2u{rowLeft, rowTop};
+}
+
+TextureAtlas::Page& TextureAtlas::createPage(unsigned width, unsigned height)
+{
+    auto texture = std::make_unique<sf::Texture>();
+    texture->create(width, height);
+    pages.push_back(Page{std::move(texture), 0, 0, 0});
+    return pages.back();
+}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "SFML/Graphics/Image.hpp"
+
+#include "TextureRegion.h"
+#include "Vector.h"
+
+namespace graphics
+{
+class TextureAtlas
+{
+public:
+    explicit TextureAtlas(unsigned pageSize);
+
+    TextureRegion add(const sf::Image&, const utils::IntRect& rectToCut);
+    std::size_t getNumberOfPages() const;
+
+private:
+    // regions are placed next to each other in rows, next row starts below highest region of previous one
+    struct Page
+    {
+        std::unique_ptr<sf::Texture> texture;
+        unsigned rowLeft;
+        unsigned rowTop;
+        unsigned rowHeight;
+    };
+
+    std::pair<Page&, utils::Vector2u> reserveRegion(unsigned width, unsigned height);
+    static std::optional<utils::Vector2u> reserveRegionInPage(Page&, unsigned width, unsigned height);
+    Page& createPage(unsigned width, unsigned height);
+
+    const unsigned pageSize;
+    std::vector<Page> pages;
+};
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "TextureAtlas.h"
+
+#include "gtest/gtest.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+namespace
+{
+const unsigned pageSize{64};
+const utils::IntRect frame{0, 0, 30, 20};
+const utils::IntRect frameBiggerThanPage{0, 0, 100, 80};
+}
+
+class TextureAtlasTest : public Test
+{
+public:
+    TextureAtlasTest()
+    {
+        image.create(200, 200);
+    }
+
+    sf::Image image;
+    TextureAtlas atlas{pageSize};
+};
+
+TEST_F(TextureAtlasTest, addedRegion_shouldHaveSizeOfRectToCut)
+{
+    const auto region = atlas.add(image, frame);
+
+    ASSERT_EQ(region.rect.width, frame.width);
+    ASSERT_EQ(region.rect.height, frame.height);
+    ASSERT_EQ(atlas.getNumberOfPages(), 1u);
+}
+
+TEST_F(TextureAtlasTest, regionsFittingInPage_shouldBePlacedInSamePageWithoutOverlapping)
+{
+    const auto region1 = atlas.add(image, frame);
+    const auto region2 = atlas.add(image, frame);
+    const auto region3 = atlas.add(image, frame);
+
+    ASSERT_EQ(region1.texture, region2.texture);
+    ASSERT_EQ(region1.texture, region3.texture);
+    ASSERT_FALSE(region1.rect.intersects(region2.rect));
+    ASSERT_FALSE(region1.rect.intersects(region3.rect));
+    ASSERT_FALSE(region2.rect.intersects(region3.rect));
+    ASSERT_EQ(atlas.getNumberOfPages(), 1u);
+}
+
+TEST_F(TextureAtlasTest, regionNotFittingInPage_shouldBePlacedInNewPage)
+{
+    std::vector<TextureRegion> regions;
+
+    for (int frameIndex = 0; frameIndex < 7; frameIndex++)
+    {
+        regions.push_back(atlas.add(image, frame));
+    }
+
+    ASSERT_EQ(atlas.getNumberOfPages(), 2u);
+    ASSERT_EQ(regions[5].texture, regions[0].texture);
+    ASSERT_NE(regions[6].texture, regions[0].texture);
+}
+
+TEST_F(TextureAtlasTest, regionBiggerThanPage_shouldGetOwnPageOfItsSize)
+{
+    atlas.add(image, frame);
+
+    const auto region = atlas.add(image, frameBiggerThanPage);
+
+    ASSERT_EQ(atlas.getNumberOfPages(), 2u);
+    ASSERT_EQ(region.texture->getSize(), utils::Vector2u(100, 80));
+}
\ No newline at end of file
@@ -23,4 +23,12 @@ void graphics::TextureLoader::load(sf::Texture& texture, const TextureRect& text
 
     throw exceptions::CannotAccessTextureFile("Cannot load texture rect: " + toString(textureRect));
 }
+
+void TextureLoader::load(sf::Image& image, const TexturePath& texturePath)
+{
+    if (not image.loadFromFile(texturePath))
+    {
+        throw exceptions::CannotAccessTextureFile("Cannot load image: " + texturePath);
+    }
+}
 }
\ No newline at end of file
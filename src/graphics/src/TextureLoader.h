@@ -1,7 +1,9 @@
 #pragma once
 
+#include "SFML/Graphics/Image.hpp"
 #include "SFML/Graphics/Texture.hpp"
 
+#include "TexturePath.h"
 #include "TextureRect.h"
 
 namespace graphics
@@ -10,5 +12,6 @@ class TextureLoader
 {
 public:
     static void load(sf::Texture&, const TextureRect&);
+    static void load(sf::Image&, const TexturePath&);
 };
 }
\ No newline at end of file
@@ -20,6 +20,7 @@ public:
     const TextureRect existingTextureRectWithRectToCutTexture{existingTexturePath,
                                                               utils::IntRect{5, 5, 5, 5}};
     sf::Texture texture;
+    sf::Image image;
 
     TextureLoader textureLoader;
 };
@@ -37,4 +38,14 @@ TEST_F(TextureLoaderTest, givenExistingTextureRectWithoutRectToCut_shouldLoadTex
 TEST_F(TextureLoaderTest, givenExistingTextureRectWithRectToCut_shouldLoadTextureAndNotThrow)
 {
     ASSERT_NO_THROW(textureLoader.load(texture, existingTextureRectWithRectToCutTexture));
+}
+
+TEST_F(TextureLoaderTest, givenNonExistingImagePath_shouldThrowCannotAccess)
+{
+    ASSERT_THROW(textureLoader.load(image, nonExistingTexturePath), exceptions::CannotAccessTextureFile);
+}
+
+TEST_F(TextureLoaderTest, givenExistingImagePath_shouldLoadImageAndNotThrow)
+{
+    ASSERT_NO_THROW(textureLoader.load(image, existingTexturePath));
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "SFML/Graphics/Texture.hpp"
+
+#include "Rect.h"
+
+namespace graphics
+{
+// part of atlas page occupied by texture rect
+struct TextureRegion
+{
+    const sf::Texture* texture;
+    utils::IntRect rect;
+};
+}
\ No newline at end of file
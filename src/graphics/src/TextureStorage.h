@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
+
 #include "TexturePath.h"
 #include "TextureRect.h"
+#include "TextureRegion.h"
 
 namespace graphics
 {
@@ -10,6 +13,10 @@ class TextureStorage
 public:
     virtual ~TextureStorage() = default;
 
-    virtual const sf::Texture& getTexture(const TextureRect&) = 0;
+    // waits for texture region, also when it is being loaded in background
+    virtual const TextureRegion& getTextureRegion(const TextureRect&) = 0;
+    // starts loading in background, texture region is returned once it was uploaded
+    virtual const TextureRegion* requestTextureRegion(const TextureRect&) = 0;
+    virtual void uploadLoadedTextures(std::chrono::microseconds timeBudget) = 0;
 };
 }
\ No newline at end of file
@@ -9,6 +9,8 @@ namespace graphics
 class TextureStorageMock : public TextureStorage
 {
 public:
-    MOCK_METHOD(const sf::Texture&, getTexture, (const TextureRect&));
+    MOCK_METHOD(const TextureRegion&, getTextureRegion, (const TextureRect&));
+    MOCK_METHOD(const TextureRegion*, requestTextureRegion, (const TextureRect&));
+    MOCK_METHOD(void, uploadLoadedTextures, (std::chrono::microseconds));
 };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "TextureStorageSfml.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "TextureLoader.h"
@@ -8,33 +9,173 @@
 
 namespace graphics
 {
+namespace
+{
+const unsigned atlasPageSize{2048};
+}
+
+TextureStorageSfml::TextureStorageSfml() : atlas{atlasPageSize} {}
+
+const TextureRegion& TextureStorageSfml::getTextureRegion(const TextureRect& textureRect)
+{
+    if (not textureRegionInStorage(textureRect))
+    {
+        if (imagesBeingLoaded.contains(textureRect.texturePath))
+        {
+            auto loadedImage = imageLoader->waitForImage(textureRect.texturePath);
+            storeLoadedImage(loadedImage);
+        }
+
+        std::erase(requestedTextureRects, textureRect);
+        loadTextureRegion(textureRect);
+    }
+    return textureRegions.at(textureRect);
+}
 
-const sf::Texture& TextureStorageSfml::getTexture(const TextureRect& textureRect)
+const TextureRegion* TextureStorageSfml::requestTextureRegion(const TextureRect& textureRect)
 {
-    if (not textureInStorage(textureRect))
+    if (const auto textureRegion = textureRegions.find(textureRect); textureRegion != textureRegions.end())
+    {
+        return &textureRegion->second;
+    }
+
+    if (const auto error = errorsOfUnavailableTextureRects.find(textureRect);
+        error != errorsOfUnavailableTextureRects.end())
+    {
+        throw exceptions::TextureNotAvailable{error->second};
+    }
+
+    if (std::find(requestedTextureRects.begin(), requestedTextureRects.end(), textureRect) !=
+        requestedTextureRects.end())
+    {
+        return nullptr;
+    }
+
+    requestedTextureRects.push_back(textureRect);
+    const auto& texturePath = textureRect.texturePath;
+
+    if (not images.contains(texturePath) and not errorsOfUnavailableImages.contains(texturePath) and
+        imagesBeingLoaded.insert(texturePath).second)
     {
-        loadTexture(textureRect);
+        if (not imageLoader)
+        {
+            imageLoader = std::make_unique<AsynchronousImageLoader>();
+        }
+
+        imageLoader->load(texturePath);
     }
-    return *textures.at(textureRect);
+
+    return nullptr;
 }
 
-void TextureStorageSfml::loadTexture(const TextureRect& textureRect)
+void TextureStorageSfml::uploadLoadedTextures(std::chrono::microseconds timeBudget)
 {
-    auto texture = std::make_unique<sf::Texture>();
+    if (not imageLoader)
+    {
+        return;
+    }
+
+    const auto uploadStart = std::chrono::steady_clock::now();
+
+    while (auto loadedImage = imageLoader->takeLoadedImage())
+    {
+        storeLoadedImage(*loadedImage);
+    }
+
+    // budget is checked after each upload, so at least one texture region is uploaded every frame
+    auto textureRect = requestedTextureRects.begin();
+    while (textureRect != requestedTextureRects.end())
+    {
+        if (imagesBeingLoaded.contains(textureRect->texturePath))
+        {
+            textureRect++;
+            continue;
+        }
+
+        try
+        {
+            loadTextureRegion(*textureRect);
+        }
+        catch (const exceptions::TextureNotAvailable& e)
+        {
+            errorsOfUnavailableTextureRects[*textureRect] = e.what();
+        }
+
+        textureRect = requestedTextureRects.erase(textureRect);
+
+        if (std::chrono::steady_clock::now() - uploadStart >= timeBudget)
+        {
+            return;
+        }
+    }
+}
+
+void TextureStorageSfml::loadTextureRegion(const TextureRect& textureRect)
+{
+    const auto& image = getImage(textureRect.texturePath);
+    const auto imageSize = image.getSize();
+    const auto wholeImage =
+        utils::IntRect{0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+
+    // rect exceeding image is cut to image bounds, same as sfml does when loading texture with rect
+    auto rectToCut = wholeImage;
+    if (textureRect.rectToCutTexture and not wholeImage.intersects(*textureRect.rectToCutTexture, rectToCut))
+    {
+        throw exceptions::TextureNotAvailable{"Texture rect outside of image: " + toString(textureRect)};
+    }
+
+    textureRegions[textureRect] = atlas.add(image, rectToCut);
+}
+
+const sf::Image& TextureStorageSfml::getImage(const TexturePath& texturePath)
+{
+    if (const auto image = images.find(texturePath); image != images.end())
+    {
+        return *image->second;
+    }
+
+    if (const auto error = errorsOfUnavailableImages.find(texturePath);
+        error != errorsOfUnavailableImages.end())
+    {
+        throw exceptions::TextureNotAvailable{error->second};
+    }
+
+    auto image = std::make_unique<sf::Image>();
     try
     {
-        TextureLoader::load(*texture, textureRect);
+        TextureLoader::load(*image, texturePath);
     }
     catch (const exceptions::CannotAccessTextureFile& e)
     {
         std::cerr << e.what() << std::endl;
         throw exceptions::TextureNotAvailable{e.what()};
     }
-    textures[textureRect] = std::move(texture);
+    return *(images[texturePath] = std::move(image));
+}
+
+void TextureStorageSfml::storeLoadedImage(AsynchronousImageLoader::LoadedImage& loadedImage)
+{
+    imagesBeingLoaded.erase(loadedImage.texturePath);
+
+    if (not loadedImage.error)
+    {
+        images[loadedImage.texturePath] = std::move(loadedImage.image);
+        return;
+    }
+
+    try
+    {
+        std::rethrow_exception(loadedImage.error);
+    }
+    catch (const exceptions::CannotAccessTextureFile& e)
+    {
+        std::cerr << e.what() << std::endl;
+        errorsOfUnavailableImages[loadedImage.texturePath] = e.what();
+    }
 }
 
-bool TextureStorageSfml::textureInStorage(const TextureRect& textureRect)
+bool TextureStorageSfml::textureRegionInStorage(const TextureRect& textureRect)
 {
-    return textures.contains(textureRect);
+    return textureRegions.contains(textureRect);
 }
 }
\ No newline at end of file
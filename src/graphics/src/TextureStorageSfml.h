@@ -2,8 +2,12 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "AsynchronousImageLoader.h"
 #include "Rect.h"
+#include "TextureAtlas.h"
 #include "TextureLoader.h"
 #include "TextureRect.h"
 #include "TextureStorage.h"
@@ -13,12 +17,26 @@ namespace graphics
 class TextureStorageSfml : public TextureStorage
 {
 public:
-    const sf::Texture& getTexture(const TextureRect& textureRect) override;
+    TextureStorageSfml();
+
+    const TextureRegion& getTextureRegion(const TextureRect& textureRect) override;
+    const TextureRegion* requestTextureRegion(const TextureRect& textureRect) override;
+    void uploadLoadedTextures(std::chrono::microseconds timeBudget) override;
 
 private:
-    void loadTexture(const TextureRect& path);
-    bool textureInStorage(const TextureRect& path);
+    void loadTextureRegion(const TextureRect&);
+    const sf::Image& getImage(const TexturePath&);
+    void storeLoadedImage(AsynchronousImageLoader::LoadedImage&);
+    bool textureRegionInStorage(const TextureRect&);
 
-    std::unordered_map<TextureRect, std::unique_ptr<sf::Texture>, TextureRectHash> textures;
+    TextureAtlas atlas;
+    std::unordered_map<TexturePath, std::unique_ptr<sf::Image>> images;
+    std::unordered_map<TextureRect, TextureRegion, TextureRectHash> textureRegions;
+    // loader thread is started with first request, so storage used only synchronously does not start it
+    std::unique_ptr<AsynchronousImageLoader> imageLoader;
+    std::unordered_set<TexturePath> imagesBeingLoaded;
+    std::vector<TextureRect> requestedTextureRects;
+    std::unordered_map<TexturePath, std::string> errorsOfUnavailableImages;
+    std::unordered_map<TextureRect, std::string, TextureRectHash> errorsOfUnavailableTextureRects;
 };
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "TextureStorageSfml.h"
 
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "ProjectPathReader.h"
@@ -19,35 +21,102 @@ public:
     const TextureRect existingTextureRectWithoutRectToCutTexture{existingTexturePath, std::nullopt};
     const TextureRect existingTextureRectWithRectToCutTexture{existingTexturePath,
                                                               utils::IntRect{5, 5, 5, 5}};
-    sf::Texture texture;
-
     TextureStorageSfml storage;
 };
 
+class AsynchronousTextureStorageSfmlTest : public TextureStorageSfmlTest
+{
+public:
+    const TextureRegion* uploadUntilTextureRegionIsAvailable(const TextureRect& textureRect)
+    {
+        for (int attempt = 0; attempt < maxNumberOfUploadAttempts; attempt++)
+        {
+            storage.uploadLoadedTextures(uploadTimeBudget);
+
+            if (const auto textureRegion = storage.requestTextureRegion(textureRect))
+            {
+                return textureRegion;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return nullptr;
+    }
+
+    const int maxNumberOfUploadAttempts{5000};
+    const std::chrono::microseconds uploadTimeBudget{2000};
+};
+
 TEST_F(TextureStorageSfmlTest, getTextureWithNonExistingTextureRect_shouldThrowTextureNotAvailable)
 {
-    ASSERT_THROW(storage.getTexture(nonExistingTextureRect), exceptions::TextureNotAvailable);
+    ASSERT_THROW(storage.getTextureRegion(nonExistingTextureRect), exceptions::TextureNotAvailable);
 }
 
 TEST_F(TextureStorageSfmlTest, getTextureWithExistingTextureRect_shouldNoThrow)
 {
-    ASSERT_NO_THROW(storage.getTexture(existingTextureRectWithoutRectToCutTexture));
-    ASSERT_NO_THROW(storage.getTexture(existingTextureRectWithRectToCutTexture));
+    ASSERT_NO_THROW(storage.getTextureRegion(existingTextureRectWithoutRectToCutTexture));
+    ASSERT_NO_THROW(storage.getTextureRegion(existingTextureRectWithRectToCutTexture));
 }
 
 TEST_F(TextureStorageSfmlTest, getTexture_shouldRememberLoadedTexture)
 {
-    const auto& texture1 = storage.getTexture(existingTextureRectWithRectToCutTexture);
-    const auto& texture2 = storage.getTexture(existingTextureRectWithRectToCutTexture);
+    const auto& textureRegion1 = storage.getTextureRegion(existingTextureRectWithRectToCutTexture);
+    const auto& textureRegion2 = storage.getTextureRegion(existingTextureRectWithRectToCutTexture);
 
-    ASSERT_EQ(&texture1, &texture2);
+    ASSERT_EQ(&textureRegion1, &textureRegion2);
 }
 
 TEST_F(TextureStorageSfmlTest,
-       getTextureTwiceWithTextureRectWithSameTexturePathButDifferentRectToCut_shouldNotReturnSameTexture)
+       sameTexturePathWithDifferentRectsToCut_shouldReturnDifferentRegionsOfSamePage)
+{
+    const auto& textureRegion1 = storage.getTextureRegion(existingTextureRectWithoutRectToCutTexture);
+    const auto& textureRegion2 = storage.getTextureRegion(existingTextureRectWithRectToCutTexture);
+
+    ASSERT_EQ(textureRegion1.texture, textureRegion2.texture);
+    ASSERT_NE(textureRegion1.rect, textureRegion2.rect);
+}
+
+TEST_F(TextureStorageSfmlTest, getTextureWithRectToCut_shouldReturnRegionOfRectSize)
 {
-    const auto& texture1 = storage.getTexture(existingTextureRectWithoutRectToCutTexture);
-    const auto& texture2 = storage.getTexture(existingTextureRectWithRectToCutTexture);
+    const auto& textureRegion = storage.getTextureRegion(existingTextureRectWithRectToCutTexture);
 
-    ASSERT_NE(&texture1, &texture2);
+    ASSERT_EQ(textureRegion.rect.width, 5);
+    ASSERT_EQ(textureRegion.rect.height, 5);
 }
+
+TEST_F(TextureStorageSfmlTest, getTextureWithRectToCutOutsideOfImage_shouldThrowTextureNotAvailable)
+{
+    const TextureRect textureRectOutsideOfImage{existingTexturePath, utils::IntRect{5000, 5000, 5, 5}};
+
+    ASSERT_THROW(storage.getTextureRegion(textureRectOutsideOfImage), exceptions::TextureNotAvailable);
+}
+
+
+TEST_F(AsynchronousTextureStorageSfmlTest, requestedTextureRegion_shouldBeAvailableAfterItWasUploaded)
+{
+    ASSERT_EQ(storage.requestTextureRegion(existingTextureRectWithRectToCutTexture), nullptr);
+
+    const auto textureRegion = uploadUntilTextureRegionIsAvailable(existingTextureRectWithRectToCutTexture);
+
+    ASSERT_NE(textureRegion, nullptr);
+    ASSERT_EQ(textureRegion->rect.width, 5);
+    ASSERT_EQ(textureRegion, &storage.getTextureRegion(existingTextureRectWithRectToCutTexture));
+}
+
+TEST_F(AsynchronousTextureStorageSfmlTest, getTextureRegionBeingLoaded_shouldWaitForIt)
+{
+    storage.requestTextureRegion(existingTextureRectWithoutRectToCutTexture);
+
+    const auto& textureRegion = storage.getTextureRegion(existingTextureRectWithoutRectToCutTexture);
+
+    ASSERT_EQ(storage.requestTextureRegion(existingTextureRectWithoutRectToCutTexture), &textureRegion);
+}
+
+TEST_F(AsynchronousTextureStorageSfmlTest,
+       requestedNonExistingTextureRect_shouldThrowTextureNotAvailableAfterItWasLoaded)
+{
+    ASSERT_EQ(storage.requestTextureRegion(nonExistingTextureRect), nullptr);
+
+    ASSERT_THROW(uploadUntilTextureRegionIsAvailable(nonExistingTextureRect),
+                 exceptions::TextureNotAvailable);
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+#include "DeltaTime.h"
+#include "Vector.h"
+
+namespace input
+{
+struct InputFrame
+{
+    utils::DeltaTime deltaTime;
+    std::uint64_t pressedKeys;
+    utils::Vector2f mouseRelativePosition;
+    utils::Vector2f mouseAbsolutePosition;
+};
+}
@@ -0,0 +1,41 @@
+#include "InputRecorder.h"
+
+#include "InputFrame.h"
+#include "InputRecordingFormat.h"
+
+namespace input
+{
+
+InputRecorder::InputRecorder(std::unique_ptr<std::ostream> outputInit) : output{std::move(outputInit)}
+{
+    write(inputRecordingMagic);
+    write(inputRecordingVersion);
+}
+
+void InputRecorder::record(const Input& input, const utils::DeltaTime& deltaTime)
+{
+    std::uint64_t pressedKeys = 0;
+
+    for (const auto& key : allKeys)
+    {
+        if (input.isKeyPressed(key))
+        {
+            pressedKeys |= std::uint64_t{1} << static_cast<unsigned>(key);
+        }
+    }
+
+    write(deltaTime.count());
+    write(pressedKeys);
+    write(input.getMouseRelativePosition().x);
+    write(input.getMouseRelativePosition().y);
+    write(input.getMouseAbsolutePosition().x);
+    write(input.getMouseAbsolutePosition().y);
+}
+
+template <typename T>
+void InputRecorder::write(const T& value)
+{
+    output->write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}
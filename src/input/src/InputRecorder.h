@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+
+#include "DeltaTime.h"
+#include "Input.h"
+#include "InputApi.h"
+
+namespace input
+{
+class INPUT_API InputRecorder
+{
+public:
+    explicit InputRecorder(std::unique_ptr<std::ostream>);
+
+    void record(const Input&, const utils::DeltaTime&);
+
+private:
+    template <typename T>
+    void write(const T& value);
+
+    std::unique_ptr<std::ostream> output;
+};
+}
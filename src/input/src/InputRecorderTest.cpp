@@ -0,0 +1,82 @@
+#include "InputRecorder.h"
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "InputRecordingReader.h"
+#include "InputSfml.h"
+#include "exceptions/InvalidInputRecording.h"
+
+using namespace ::testing;
+using namespace input;
+
+namespace
+{
+const utils::Vector2f relativeMousePosition{3, 4};
+const utils::Vector2f absoluteMousePosition{13, 4};
+const utils::DeltaTime deltaTime1{0.016f};
+const utils::DeltaTime deltaTime2{0.008f};
+}
+
+class InputRecorderTest : public Test
+{
+public:
+    std::string record(const std::vector<std::pair<InputSfml, utils::DeltaTime>>& framesToRecord)
+    {
+        auto outputInit = std::make_unique<std::ostringstream>();
+        auto output = outputInit.get();
+        InputRecorder recorder{std::move(outputInit)};
+
+        for (const auto& [frameInput, frameDeltaTime] : framesToRecord)
+        {
+            recorder.record(frameInput, frameDeltaTime);
+        }
+
+        return output->str();
+    }
+
+    InputSfml input;
+};
+
+TEST_F(InputRecorderTest, recordedFrames_shouldBeReadBack)
+{
+    input.setKeyPressed(InputKey::Space);
+    input.setKeyPressed(InputKey::MouseLeft);
+    input.setMouseRelativePosition(relativeMousePosition);
+    input.setMouseAbsolutePosition(absoluteMousePosition);
+    std::istringstream recording{record({{input, deltaTime1}, {InputSfml{}, deltaTime2}})};
+
+    const auto frames = InputRecordingReader::read(recording);
+
+    ASSERT_EQ(frames.size(), 2u);
+    ASSERT_EQ(frames[0].deltaTime, deltaTime1);
+    ASSERT_EQ(frames[0].pressedKeys, (std::uint64_t{1} << static_cast<unsigned>(InputKey::Space)) |
+                                         (std::uint64_t{1} << static_cast<unsigned>(InputKey::MouseLeft)));
+    ASSERT_EQ(frames[0].mouseRelativePosition, relativeMousePosition);
+    ASSERT_EQ(frames[0].mouseAbsolutePosition, absoluteMousePosition);
+    ASSERT_EQ(frames[1].deltaTime, deltaTime2);
+    ASSERT_EQ(frames[1].pressedKeys, 0u);
+}
+
+TEST_F(InputRecorderTest, recordingWithoutFrames_shouldBeReadAsEmpty)
+{
+    std::istringstream recording{record({})};
+
+    ASSERT_TRUE(InputRecordingReader::read(recording).empty());
+}
+
+TEST_F(InputRecorderTest, recordingWithInvalidHeader_shouldThrow)
+{
+    std::istringstream recording{"not a recording"};
+
+    ASSERT_THROW(InputRecordingReader::read(recording), exceptions::InvalidInputRecording);
+}
+
+TEST_F(InputRecorderTest, recordingCutInTheMiddleOfFrame_shouldThrow)
+{
+    const auto fullRecording = record({{input, deltaTime1}});
+    std::istringstream recording{fullRecording.substr(0, fullRecording.size() - 1)};
+
+    ASSERT_THROW(InputRecordingReader::read(recording), exceptions::InvalidInputRecording);
+}
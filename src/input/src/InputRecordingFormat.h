@@ -0,0 +1,11 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace input
+{
+// frames are written in native byte order, recordings are meant to be replayed on the machine they come from
+const std::array<char, 4> inputRecordingMagic{'C', 'H', 'I', 'R'};
+const std::uint32_t inputRecordingVersion{1};
+}
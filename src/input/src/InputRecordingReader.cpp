@@ -0,0 +1,50 @@
+#include "InputRecordingReader.h"
+
+#include "InputRecordingFormat.h"
+#include "exceptions/InvalidInputRecording.h"
+
+namespace input
+{
+namespace
+{
+template <typename T>
+bool readValue(std::istream& inputStream, T& value)
+{
+    return static_cast<bool>(inputStream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+}
+
+std::vector<InputFrame> InputRecordingReader::read(std::istream& inputStream)
+{
+    std::array<char, 4> magic{};
+    std::uint32_t version{};
+
+    if (not readValue(inputStream, magic) or magic != inputRecordingMagic or
+        not readValue(inputStream, version) or version != inputRecordingVersion)
+    {
+        throw exceptions::InvalidInputRecording{"Input recording header is invalid"};
+    }
+
+    std::vector<InputFrame> frames;
+    float deltaSeconds{};
+
+    while (readValue(inputStream, deltaSeconds))
+    {
+        InputFrame frame{utils::DeltaTime{deltaSeconds}, 0, {}, {}};
+
+        if (not readValue(inputStream, frame.pressedKeys) or
+            not readValue(inputStream, frame.mouseRelativePosition.x) or
+            not readValue(inputStream, frame.mouseRelativePosition.y) or
+            not readValue(inputStream, frame.mouseAbsolutePosition.x) or
+            not readValue(inputStream, frame.mouseAbsolutePosition.y))
+        {
+            throw exceptions::InvalidInputRecording{"Input recording ends in the middle of a frame"};
+        }
+
+        frames.push_back(frame);
+    }
+
+    return frames;
+}
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <istream>
+#include <vector>
+
+#include "InputApi.h"
+#include "InputFrame.h"
+
+namespace input
+{
+class INPUT_API InputRecordingReader
+{
+public:
+    static std::vector<InputFrame> read(std::istream&);
+};
+}
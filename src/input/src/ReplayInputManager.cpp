@@ -0,0 +1,48 @@
+#include "ReplayInputManager.h"
+
+namespace input
+{
+
+ReplayInputManager::ReplayInputManager(std::unique_ptr<Input> inputInit, std::vector<InputFrame> framesInit)
+    : input{std::move(inputInit)}, frames{std::move(framesInit)}, nextFrameIndex{0}
+{
+}
+
+const Input& ReplayInputManager::readInput()
+{
+    input->clearPressedKeys();
+
+    if (not hasNextFrame())
+    {
+        input->setReleasedKeys();
+        return *input;
+    }
+
+    const auto& frame = frames[nextFrameIndex++];
+
+    for (const auto& key : allKeys)
+    {
+        if (frame.pressedKeys & (std::uint64_t{1} << static_cast<unsigned>(key)))
+        {
+            input->setKeyPressed(key);
+        }
+    }
+
+    input->setReleasedKeys();
+    input->setMouseRelativePosition(frame.mouseRelativePosition);
+    input->setMouseAbsolutePosition(frame.mouseAbsolutePosition);
+
+    return *input;
+}
+
+bool ReplayInputManager::hasNextFrame() const
+{
+    return nextFrameIndex < frames.size();
+}
+
+utils::DeltaTime ReplayInputManager::getDeltaTime() const
+{
+    return nextFrameIndex == 0 ? utils::DeltaTime{0} : frames[nextFrameIndex - 1].deltaTime;
+}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "InputFrame.h"
+#include "InputManager.h"
+
+namespace input
+{
+class INPUT_API ReplayInputManager : public InputManager
+{
+public:
+    ReplayInputManager(std::unique_ptr<Input>, std::vector<InputFrame>);
+
+    const Input& readInput() override;
+    bool hasNextFrame() const;
+    utils::DeltaTime getDeltaTime() const;
+
+private:
+    std::unique_ptr<Input> input;
+    std::vector<InputFrame> frames;
+    std::size_t nextFrameIndex;
+};
+}
@@ -0,0 +1,57 @@
+#include "ReplayInputManager.h"
+
+#include "gtest/gtest.h"
+
+#include "InputSfml.h"
+
+using namespace ::testing;
+using namespace input;
+
+namespace
+{
+const utils::Vector2f relativeMousePosition{3, 4};
+const utils::Vector2f absoluteMousePosition{13, 4};
+const utils::DeltaTime deltaTime1{0.016f};
+const utils::DeltaTime deltaTime2{0.008f};
+const auto spacePressed = std::uint64_t{1} << static_cast<unsigned>(InputKey::Space);
+}
+
+class ReplayInputManagerTest : public Test
+{
+public:
+    ReplayInputManager inputManager{
+        std::make_unique<InputSfml>(),
+        {{deltaTime1, spacePressed, relativeMousePosition, absoluteMousePosition}, {deltaTime2, 0, {}, {}}}};
+};
+
+TEST_F(ReplayInputManagerTest, readInput_shouldApplyRecordedFrame)
+{
+    const auto& input = inputManager.readInput();
+
+    ASSERT_TRUE(input.isKeyPressed(InputKey::Space));
+    ASSERT_FALSE(input.isKeyPressed(InputKey::Enter));
+    ASSERT_EQ(input.getMouseRelativePosition(), relativeMousePosition);
+    ASSERT_EQ(input.getMouseAbsolutePosition(), absoluteMousePosition);
+    ASSERT_EQ(inputManager.getDeltaTime(), deltaTime1);
+}
+
+TEST_F(ReplayInputManagerTest, keyNotPressedInNextFrame_shouldBeReleased)
+{
+    inputManager.readInput();
+
+    const auto& input = inputManager.readInput();
+
+    ASSERT_FALSE(input.isKeyPressed(InputKey::Space));
+    ASSERT_TRUE(input.isKeyReleased(InputKey::Space));
+    ASSERT_EQ(inputManager.getDeltaTime(), deltaTime2);
+}
+
+TEST_F(ReplayInputManagerTest, afterReadingAllFrames_shouldNotHaveNextFrame)
+{
+    ASSERT_TRUE(inputManager.hasNextFrame());
+
+    inputManager.readInput();
+    inputManager.readInput();
+
+    ASSERT_FALSE(inputManager.hasNextFrame());
+}
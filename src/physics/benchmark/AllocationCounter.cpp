@@ -0,0 +1,93 @@
+#include "AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace
+{
+std::atomic<std::size_t> numberOfAllocations{0};
+std::atomic<std::size_t> numberOfAllocatedBytes{0};
+}
+
+void* operator new(std::size_t size)
+{
+    numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    numberOfAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (auto memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    numberOfAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    const auto alignmentInBytes = static_cast<std::size_t>(alignment);
+    const auto nonZeroSize = std::max<std::size_t>(size, 1);
+
+#ifdef _MSC_VER
+    // memory from _aligned_malloc cannot be released with free, so aligned deletes use _aligned_free
+    if (auto memory = _aligned_malloc(nonZeroSize, alignmentInBytes))
+    {
+        return memory;
+    }
+#else
+    // aligned_alloc requires size to be a multiple of alignment
+    const auto alignedSize = (nonZeroSize + alignmentInBytes - 1) / alignmentInBytes * alignmentInBytes;
+
+    if (auto memory = std::aligned_alloc(alignmentInBytes, alignedSize))
+    {
+        return memory;
+    }
+#endif
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+#ifdef _MSC_VER
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+#ifdef _MSC_VER
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+namespace physics::benchmark
+{
+AllocationCount getAllocationCount()
+{
+    return {numberOfAllocations.load(std::memory_order_relaxed),
+            numberOfAllocatedBytes.load(std::memory_order_relaxed)};
+}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace physics::benchmark
+{
+struct AllocationCount
+{
+    std::size_t numberOfAllocations;
+    std::size_t numberOfBytes;
+};
+
+// counts every call of global operator new made so far by any thread
+AllocationCount getAllocationCount();
+}
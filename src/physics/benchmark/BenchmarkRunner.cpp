@@ -0,0 +1,77 @@
+#include "BenchmarkRunner.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "AllocationCounter.h"
+
+namespace physics::benchmark
+{
+namespace
+{
+const std::chrono::nanoseconds minimumMeasuredTime = std::chrono::milliseconds{200};
+const auto minimumNumberOfIterations = 3;
+const auto maximumNumberOfIterations = 100000;
+}
+
+void BenchmarkRunner::run(const std::string& name, const std::string& scene, int numberOfColliders,
+                          int itemsPerIteration, const std::function<void()>& prepareIteration,
+                          const std::function<void()>& iteration)
+{
+    std::chrono::nanoseconds measuredTime{0};
+    std::size_t numberOfAllocations = 0;
+    std::size_t numberOfAllocatedBytes = 0;
+    int numberOfIterations = 0;
+
+    while (numberOfIterations < maximumNumberOfIterations and
+           (numberOfIterations < minimumNumberOfIterations or measuredTime < minimumMeasuredTime))
+    {
+        prepareIteration();
+
+        const auto allocationCountBefore = getAllocationCount();
+        const auto start = std::chrono::steady_clock::now();
+        iteration();
+        const auto end = std::chrono::steady_clock::now();
+        const auto allocationCountAfter = getAllocationCount();
+
+        measuredTime += end - start;
+        numberOfAllocations +=
+            allocationCountAfter.numberOfAllocations - allocationCountBefore.numberOfAllocations;
+        numberOfAllocatedBytes += allocationCountAfter.numberOfBytes - allocationCountBefore.numberOfBytes;
+        numberOfIterations++;
+    }
+
+    const auto iterations = static_cast<double>(numberOfIterations);
+    const auto nanosecondsPerIteration = static_cast<double>(measuredTime.count()) / iterations;
+    results.push_back({name, scene, numberOfColliders, numberOfIterations, nanosecondsPerIteration,
+                       itemsPerIteration * 1e9 / nanosecondsPerIteration,
+                       static_cast<double>(numberOfAllocations) / iterations,
+                       static_cast<double>(numberOfAllocatedBytes) / iterations});
+
+    std::cerr << std::setw(40) << name << std::setw(26) << scene << std::setw(8) << numberOfColliders
+              << std::fixed << std::setprecision(3) << std::setw(14) << nanosecondsPerIteration / 1e6 << " ms"
+              << std::setw(12) << results.back().allocationsPerIteration << " allocs" << std::endl;
+}
+
+void BenchmarkRunner::writeJson(std::ostream& stream) const
+{
+    stream << "{\n  \"benchmarks\": [";
+
+    for (std::size_t resultIndex = 0; resultIndex < results.size(); resultIndex++)
+    {
+        const auto& result = results[resultIndex];
+        stream << (resultIndex == 0 ? "\n" : ",\n") << std::setprecision(6) << std::defaultfloat
+               << "    {\"name\": \"" << result.name << "\", \"scene\": \"" << result.scene
+               << "\", \"colliders\": " << result.numberOfColliders
+               << ", \"iterations\": " << result.numberOfIterations
+               << ", \"nanosecondsPerIteration\": " << result.nanosecondsPerIteration
+               << ", \"itemsPerSecond\": " << result.itemsPerSecond
+               << ", \"allocationsPerIteration\": " << result.allocationsPerIteration
+               << ", \"allocatedBytesPerIteration\": " << result.allocatedBytesPerIteration << "}";
+    }
+
+    stream << "\n  ]\n}" << std::endl;
+}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace physics::benchmark
+{
+struct BenchmarkResult
+{
+    std::string name;
+    std::string scene;
+    int numberOfColliders;
+    int numberOfIterations;
+    double nanosecondsPerIteration;
+    double itemsPerSecond;
+    double allocationsPerIteration;
+    double allocatedBytesPerIteration;
+};
+
+// repeats measured step until it took minimum time, preparation before every step is not measured
+class BenchmarkRunner
+{
+public:
+    void run(const std::string& name, const std::string& scene, int numberOfColliders, int itemsPerIteration,
+             const std::function<void()>& prepareIteration, const std::function<void()>& iteration);
+    void writeJson(std::ostream&) const;
+
+private:
+    std::vector<BenchmarkResult> results;
+};
+}
@@ -0,0 +1,147 @@
+#include "BenchmarkScene.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace physics::benchmark
+{
+namespace
+{
+const auto tileSize = 4.f;
+const utils::Vector2f characterSize{tileSize, tileSize * 2};
+// every collider gets on average area of four by four tiles, whatever size of scene
+const auto mapAreaPerCollider = 16 * tileSize * tileSize;
+const auto mapAspectRatio = 4.f;
+const auto numberOfCollidersPerCluster = 50;
+const auto clusterRadius = 8 * tileSize;
+const auto maxCharacterSpeed = 0.5f;
+int numberOfCreatedOwners = 0;
+std::mt19937 randomEngine{42};
+
+float getFractionOfCharacters(ColliderMix mix)
+{
+    return mix == ColliderMix::TileHeavy ? 0.1f : 0.8f;
+}
+}
+
+BenchmarkScene::BenchmarkScene(const SceneSettings& settingsInit)
+    : settings{settingsInit}, sharedContext{std::make_shared<components::core::SharedContext>(nullptr)}
+{
+    const auto mapHeight = std::sqrt(static_cast<float>(settings.numberOfColliders) * mapAreaPerCollider /
+                                     mapAspectRatio);
+    bounds = {0, 0, mapHeight * mapAspectRatio, mapHeight};
+
+    std::uniform_real_distribution<float> positionsX{clusterRadius, bounds.width - clusterRadius};
+    std::uniform_real_distribution<float> positionsY{clusterRadius, bounds.height - clusterRadius};
+    for (int clusterIndex = 0; clusterIndex <= settings.numberOfColliders / numberOfCollidersPerCluster;
+         clusterIndex++)
+    {
+        clusterCentres.emplace_back(positionsX(randomEngine), positionsY(randomEngine));
+    }
+
+    const auto numberOfCharacters = static_cast<int>(static_cast<float>(settings.numberOfColliders) *
+                                                     getFractionOfCharacters(settings.mix));
+
+    for (int colliderIndex = 0; colliderIndex < settings.numberOfColliders; colliderIndex++)
+    {
+        if (colliderIndex < numberOfCharacters)
+        {
+            addCharacter(generatePosition());
+        }
+        else
+        {
+            addTile(generatePosition());
+        }
+    }
+}
+
+void BenchmarkScene::moveCharacters()
+{
+    for (std::size_t characterIndex = 0; characterIndex < characters.size(); characterIndex++)
+    {
+        auto& transform = characters[characterIndex]->transform;
+        auto position = transform->getPosition();
+        position.x += speedsOfCharacters[characterIndex];
+
+        if (position.x < 0 or position.x > bounds.width - characterSize.x)
+        {
+            speedsOfCharacters[characterIndex] = -speedsOfCharacters[characterIndex];
+        }
+
+        transform->setPosition(position);
+    }
+}
+
+std::string BenchmarkScene::getName() const
+{
+    const std::string distributionName =
+        settings.distribution == ColliderDistribution::Uniform ? "uniform" : "clustered";
+    const std::string mixName = settings.mix == ColliderMix::TileHeavy ? "tileHeavy" : "characterHeavy";
+    return distributionName + "/" + mixName;
+}
+
+const utils::FloatRect& BenchmarkScene::getBounds() const
+{
+    return bounds;
+}
+
+std::vector<std::shared_ptr<components::core::ComponentOwner>>& BenchmarkScene::getOwners()
+{
+    return owners;
+}
+
+const std::vector<std::shared_ptr<components::core::BoxColliderComponent>>&
+BenchmarkScene::getColliders() const
+{
+    return colliders;
+}
+
+const std::vector<std::shared_ptr<components::core::ComponentOwner>>& BenchmarkScene::getCharacters() const
+{
+    return characters;
+}
+
+utils::Vector2f BenchmarkScene::generatePosition()
+{
+    if (settings.distribution == ColliderDistribution::Uniform)
+    {
+        std::uniform_real_distribution<float> positionsX{0.f, bounds.width - characterSize.x};
+        std::uniform_real_distribution<float> positionsY{0.f, bounds.height - characterSize.y};
+        return {positionsX(randomEngine), positionsY(randomEngine)};
+    }
+
+    std::uniform_int_distribution<std::size_t> clusterIndices{0, clusterCentres.size() - 1};
+    std::normal_distribution<float> offsets{0.f, clusterRadius / 2};
+    const auto& clusterCentre = clusterCentres[clusterIndices(randomEngine)];
+    return {std::clamp(clusterCentre.x + offsets(randomEngine), 0.f, bounds.width - characterSize.x),
+            std::clamp(clusterCentre.y + offsets(randomEngine), 0.f, bounds.height - characterSize.y)};
+}
+
+void BenchmarkScene::addTile(const utils::Vector2f& position)
+{
+    const utils::Vector2f positionOnTileGrid{std::floor(position.x / tileSize) * tileSize,
+                                             std::floor(position.y / tileSize) * tileSize};
+    auto owner = std::make_shared<components::core::ComponentOwner>(
+        positionOnTileGrid, "physicsBenchmarkTile" + std::to_string(numberOfCreatedOwners++), sharedContext);
+    colliders.push_back(owner->addComponent<components::core::BoxColliderComponent>(
+        utils::Vector2f{tileSize, tileSize}, components::core::CollisionLayer::Tile));
+    owner->loadDependentComponents();
+    owners.push_back(std::move(owner));
+}
+
+void BenchmarkScene::addCharacter(const utils::Vector2f& position)
+{
+    std::uniform_real_distribution<float> speeds{-maxCharacterSpeed, maxCharacterSpeed};
+    auto owner = std::make_shared<components::core::ComponentOwner>(
+        position, "physicsBenchmarkCharacter" + std::to_string(numberOfCreatedOwners++), sharedContext);
+    auto movementComponent = owner->addComponent<components::core::MovementComponent>();
+    colliders.push_back(owner->addComponent<components::core::BoxColliderComponent>(
+        characterSize, components::core::CollisionLayer::Player, utils::Vector2f{0, 0}, movementComponent));
+    owner->loadDependentComponents();
+    characters.push_back(owner);
+    speedsOfCharacters.push_back(speeds(randomEngine));
+    owners.push_back(std::move(owner));
+}
+
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BoxColliderComponent.h"
+#include "ComponentOwner.h"
+
+namespace physics::benchmark
+{
+enum class ColliderDistribution
+{
+    Uniform,
+    Clustered
+};
+
+enum class ColliderMix
+{
+    TileHeavy,
+    CharacterHeavy
+};
+
+struct SceneSettings
+{
+    int numberOfColliders;
+    ColliderDistribution distribution;
+    ColliderMix mix;
+};
+
+// tiles are static colliders on tile grid, characters have movement component and move horizontally
+class BenchmarkScene
+{
+public:
+    explicit BenchmarkScene(const SceneSettings&);
+
+    void moveCharacters();
+    std::string getName() const;
+    const utils::FloatRect& getBounds() const;
+    std::vector<std::shared_ptr<components::core::ComponentOwner>>& getOwners();
+    const std::vector<std::shared_ptr<components::core::BoxColliderComponent>>& getColliders() const;
+    const std::vector<std::shared_ptr<components::core::ComponentOwner>>& getCharacters() const;
+
+private:
+    utils::Vector2f generatePosition();
+    void addTile(const utils::Vector2f& position);
+    void addCharacter(const utils::Vector2f& position);
+
+    const SceneSettings settings;
+    utils::FloatRect bounds;
+    std::vector<utils::Vector2f> clusterCentres;
+    std::shared_ptr<components::core::SharedContext> sharedContext;
+    std::vector<std::shared_ptr<components::core::ComponentOwner>> owners;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>> colliders;
+    std::vector<std::shared_ptr<components::core::ComponentOwner>> characters;
+    std::vector<float> speedsOfCharacters;
+};
+}
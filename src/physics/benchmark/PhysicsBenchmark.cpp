@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "BenchmarkRunner.h"
+#include "BenchmarkScene.h"
+#include "DefaultPhysicsFactory.h"
+#include "DefaultQuadtree.h"
+#include "DefaultRayCast.h"
+
+using namespace physics;
+using namespace physics::benchmark;
+
+namespace
+{
+const auto maxNumberOfQueriesPerIteration = 1000;
+const auto rayLength = 32.f;
+const std::vector<BroadphaseType> broadphaseTypes{BroadphaseType::Quadtree, BroadphaseType::SpatialHashGrid,
+                                                  BroadphaseType::SweepAndPrune};
+const std::vector<unsigned int> numbersOfThreads{1, 2, 4, 8};
+
+std::string getBroadphaseName(BroadphaseType broadphaseType)
+{
+    switch (broadphaseType)
+    {
+    case BroadphaseType::SpatialHashGrid:
+        return "spatialHashGrid";
+    case BroadphaseType::SweepAndPrune:
+        return "sweepAndPrune";
+    case BroadphaseType::Quadtree:
+        break;
+    }
+
+    return "quadtree";
+}
+
+// queries and rays start from evenly spread colliders, so their number does not grow with scene
+template <typename T>
+std::vector<T> takeEvenlySpread(const std::vector<T>& elements)
+{
+    const auto step = std::max<std::size_t>(elements.size() / maxNumberOfQueriesPerIteration, 1);
+    std::vector<T> takenElements;
+
+    for (std::size_t index = 0; index < elements.size(); index += step)
+    {
+        takenElements.push_back(elements[index]);
+    }
+
+    return takenElements;
+}
+
+void runQuadtreeBenchmarks(BenchmarkRunner& runner, BenchmarkScene& scene, int numberOfColliders)
+{
+    const auto& colliders = scene.getColliders();
+    std::unique_ptr<DefaultQuadtree> quadtree;
+    const auto fillQuadtree = [&]
+    {
+        for (const auto& collider : colliders)
+        {
+            quadtree->insertCollider(collider);
+        }
+    };
+
+    runner.run(
+        "quadtreeInsert", scene.getName(), numberOfColliders, numberOfColliders,
+        [&] { quadtree = std::make_unique<DefaultQuadtree>(scene.getBounds()); }, fillQuadtree);
+
+    runner.run(
+        "quadtreeClear", scene.getName(), numberOfColliders, numberOfColliders, fillQuadtree,
+        [&] { quadtree->clearAllColliders(); });
+
+    fillQuadtree();
+    const auto queriedColliders = takeEvenlySpread(colliders);
+    std::vector<components::core::BoxColliderComponent*> possibleColliders;
+
+    runner.run(
+        "quadtreeQuery", scene.getName(), numberOfColliders, static_cast<int>(queriedColliders.size()), [] {},
+        [&]
+        {
+            for (const auto& collider : queriedColliders)
+            {
+                possibleColliders.clear();
+                quadtree->getPossibleCollidersInArea(collider->getCollisionBox(), possibleColliders);
+            }
+        });
+}
+
+// every broadphase is built by factory, so it sits behind the same static tile grid as in the game
+void runBroadphaseBenchmark(BenchmarkRunner& runner, BenchmarkScene& scene, int numberOfColliders,
+                            BroadphaseType broadphaseType)
+{
+    const DefaultPhysicsFactory physicsFactory{scene.getBounds(), {.type = broadphaseType}};
+    const auto broadphase = physicsFactory.getQuadTree();
+    const auto& colliders = scene.getColliders();
+    for (const auto& collider : colliders)
+    {
+        broadphase->insertCollider(collider);
+    }
+
+    const auto queriedColliders = takeEvenlySpread(colliders);
+    std::vector<components::core::BoxColliderComponent*> possibleColliders;
+
+    runner.run(
+        "broadphaseUpdate/" + getBroadphaseName(broadphaseType), scene.getName(), numberOfColliders,
+        numberOfColliders, [&] { scene.moveCharacters(); },
+        [&]
+        {
+            for (const auto& collider : colliders)
+            {
+                broadphase->updateCollider(collider);
+            }
+
+            for (const auto& collider : queriedColliders)
+            {
+                possibleColliders.clear();
+                broadphase->getPossibleCollidersInArea(collider->getCollisionBox(), possibleColliders);
+            }
+        });
+}
+
+void runCollisionSystemBenchmark(BenchmarkRunner& runner, BenchmarkScene& scene, int numberOfColliders,
+                                 const std::string& name, const BroadphaseSettings& broadphaseSettings,
+                                 const CollisionSystemSettings& collisionSystemSettings)
+{
+    const DefaultPhysicsFactory physicsFactory{scene.getBounds(), broadphaseSettings,
+                                               collisionSystemSettings};
+    const auto collisionSystem = physicsFactory.createCollisionSystem();
+    collisionSystem->add(scene.getOwners());
+
+    runner.run(
+        name, scene.getName(), numberOfColliders, numberOfColliders, [&] { scene.moveCharacters(); },
+        [&] { collisionSystem->update(); });
+}
+
+void runCollisionSystemBenchmarks(BenchmarkRunner& runner, BenchmarkScene& scene, int numberOfColliders)
+{
+    for (const auto broadphaseType : broadphaseTypes)
+    {
+        runBroadphaseBenchmark(runner, scene, numberOfColliders, broadphaseType);
+        runCollisionSystemBenchmark(runner, scene, numberOfColliders,
+                                    "collisionSystemUpdate/" + getBroadphaseName(broadphaseType),
+                                    {.type = broadphaseType}, {});
+    }
+
+    // thread scaling of resolving is measured with broadphase the game builds by default
+    for (const auto numberOfThreads : numbersOfThreads)
+    {
+        runCollisionSystemBenchmark(runner, scene, numberOfColliders,
+                                    "collisionSystemUpdate/threads" + std::to_string(numberOfThreads), {},
+                                    {.numberOfThreads = numberOfThreads});
+    }
+}
+
+void runRayCastBenchmark(BenchmarkRunner& runner, BenchmarkScene& scene, int numberOfColliders)
+{
+    const auto quadtree = std::make_shared<DefaultQuadtree>(scene.getBounds());
+    for (const auto& collider : scene.getColliders())
+    {
+        quadtree->insertCollider(collider);
+    }
+
+    const DefaultRayCast rayCast{quadtree};
+    const auto castingCharacters = takeEvenlySpread(scene.getCharacters());
+
+    runner.run(
+        "rayCast", scene.getName(), numberOfColliders, static_cast<int>(castingCharacters.size()), [] {},
+        [&]
+        {
+            for (const auto& character : castingCharacters)
+            {
+                const auto& from = character->transform->getPosition();
+                rayCast.cast(from, {from.x + rayLength, from.y}, character->getId());
+            }
+        });
+}
+}
+
+// usage: physicsBench [--max-colliders=N] [--output=results.json]
+// json results go to standard output when no output file is given, progress goes to standard error
+int main(int argc, char* argv[])
+{
+    int maxNumberOfColliders = 100000;
+    std::string outputPath;
+
+    for (int argumentIndex = 1; argumentIndex < argc; argumentIndex++)
+    {
+        const std::string argument{argv[argumentIndex]};
+
+        if (argument.starts_with("--max-colliders="))
+        {
+            maxNumberOfColliders = std::stoi(argument.substr(std::string{"--max-colliders="}.size()));
+        }
+        else if (argument.starts_with("--output="))
+        {
+            outputPath = argument.substr(std::string{"--output="}.size());
+        }
+    }
+
+    BenchmarkRunner runner;
+
+    for (const auto numberOfColliders : {100, 1000, 10000, 100000})
+    {
+        if (numberOfColliders > maxNumberOfColliders)
+        {
+            break;
+        }
+
+        for (const auto distribution : {ColliderDistribution::Uniform, ColliderDistribution::Clustered})
+        {
+            for (const auto mix : {ColliderMix::TileHeavy, ColliderMix::CharacterHeavy})
+            {
+                BenchmarkScene scene{{numberOfColliders, distribution, mix}};
+                runQuadtreeBenchmarks(runner, scene, numberOfColliders);
+                runCollisionSystemBenchmarks(runner, scene, numberOfColliders);
+                runRayCastBenchmark(runner, scene, numberOfColliders);
+            }
+        }
+    }
+
+    if (outputPath.empty())
+    {
+        runner.writeJson(std::cout);
+        return 0;
+    }
+
+    std::ofstream output{outputPath};
+    runner.writeJson(output);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace physics
+{
+enum class BroadphaseType
+{
+    Quadtree,
+    SpatialHashGrid,
+    SweepAndPrune
+};
+
+struct BroadphaseSettings
+{
+    BroadphaseType type{BroadphaseType::Quadtree};
+    float cellSize{4.f};
+};
+}
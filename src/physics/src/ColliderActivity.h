@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Rect.h"
+
+namespace physics
+{
+// collider which boxes and surroundings have not changed for a while is put to sleep and skipped in resolving
+struct ColliderActivity
+{
+    utils::FloatRect nextFrameXCollisionBox{};
+    utils::FloatRect nextFrameYCollisionBox{};
+    bool hasBoxes{false};
+    std::size_t numberOfPossibleCollisions{0};
+    int numberOfFramesWithoutChange{0};
+    bool asleep{false};
+};
+}
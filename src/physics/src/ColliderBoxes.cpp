@@ -0,0 +1,101 @@
+#include "ColliderBoxes.h"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace physics
+{
+
+void ColliderBoxes::add(const utils::FloatRect& box)
+{
+    lefts.push_back(box.left);
+    tops.push_back(box.top);
+    widths.push_back(box.width);
+    heights.push_back(box.height);
+}
+
+void ColliderBoxes::clear()
+{
+    lefts.clear();
+    tops.clear();
+    widths.clear();
+    heights.clear();
+}
+
+std::size_t ColliderBoxes::size() const
+{
+    return lefts.size();
+}
+
+utils::FloatRect ColliderBoxes::getBox(std::size_t index) const
+{
+    return {lefts[index], tops[index], widths[index], heights[index]};
+}
+
+void ColliderBoxes::getIndicesOfBoxesCollidingWith(const utils::FloatRect& box, std::vector<int>& indices) const
+{
+    const float boxRight = box.left + box.width;
+    const float boxBottom = box.top + box.height;
+    const float boxCentreX = box.left + box.width / 2;
+    const float boxCentreY = box.top + box.height / 2;
+
+    std::size_t index = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+    const auto boxLefts = _mm_set1_ps(box.left);
+    const auto boxTops = _mm_set1_ps(box.top);
+    const auto boxRights = _mm_set1_ps(boxRight);
+    const auto boxBottoms = _mm_set1_ps(boxBottom);
+    const auto boxCentresX = _mm_set1_ps(boxCentreX);
+    const auto boxCentresY = _mm_set1_ps(boxCentreY);
+    const auto halves = _mm_set1_ps(0.5f);
+
+    for (; index + 4 <= size(); index += 4)
+    {
+        const auto otherLefts = _mm_loadu_ps(&lefts[index]);
+        const auto otherTops = _mm_loadu_ps(&tops[index]);
+        const auto otherWidths = _mm_loadu_ps(&widths[index]);
+        const auto otherHeights = _mm_loadu_ps(&heights[index]);
+
+        const auto intersectionLefts = _mm_max_ps(boxLefts, otherLefts);
+        const auto intersectionRights = _mm_min_ps(boxRights, _mm_add_ps(otherLefts, otherWidths));
+        const auto intersectionTops = _mm_max_ps(boxTops, otherTops);
+        const auto intersectionBottoms = _mm_min_ps(boxBottoms, _mm_add_ps(otherTops, otherHeights));
+        const auto intersect = _mm_and_ps(_mm_cmplt_ps(intersectionLefts, intersectionRights),
+                                          _mm_cmplt_ps(intersectionTops, intersectionBottoms));
+
+        const auto otherCentresX = _mm_add_ps(otherLefts, _mm_mul_ps(otherWidths, halves));
+        const auto otherCentresY = _mm_add_ps(otherTops, _mm_mul_ps(otherHeights, halves));
+        const auto centresDiffer = _mm_or_ps(_mm_cmpneq_ps(otherCentresX, boxCentresX),
+                                             _mm_cmpneq_ps(otherCentresY, boxCentresY));
+
+        auto collidingLanes = static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(intersect, centresDiffer)));
+
+        while (collidingLanes != 0)
+        {
+            indices.push_back(static_cast<int>(index) + std::countr_zero(collidingLanes));
+            collidingLanes &= collidingLanes - 1;
+        }
+    }
+#endif
+
+    for (; index < size(); index++)
+    {
+        const auto intersect =
+            std::max(box.left, lefts[index]) < std::min(boxRight, lefts[index] + widths[index]) and
+            std::max(box.top, tops[index]) < std::min(boxBottom, tops[index] + heights[index]);
+        const auto centresDiffer = lefts[index] + widths[index] / 2 != boxCentreX or
+                                   tops[index] + heights[index] / 2 != boxCentreY;
+
+        if (intersect and centresDiffer)
+        {
+            indices.push_back(static_cast<int>(index));
+        }
+    }
+}
+
+}
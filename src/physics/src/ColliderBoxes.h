@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+
+#include "Rect.h"
+
+namespace physics
+{
+class ColliderBoxes
+{
+public:
+    void add(const utils::FloatRect&);
+    void clear();
+    std::size_t size() const;
+    utils::FloatRect getBox(std::size_t index) const;
+    // appends indices of boxes intersecting with box whose centres are different than centre of box
+    void getIndicesOfBoxesCollidingWith(const utils::FloatRect& box, std::vector<int>& indices) const;
+
+private:
+    std::vector<float> lefts;
+    std::vector<float> tops;
+    std::vector<float> widths;
+    std::vector<float> heights;
+};
+}
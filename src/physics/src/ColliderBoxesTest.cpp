@@ -0,0 +1,104 @@
+#include "ColliderBoxes.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "RectDistance.h"
+
+using namespace physics;
+using namespace ::testing;
+
+class ColliderBoxesTest : public Test
+{
+public:
+    const utils::FloatRect box{10, 10, 4, 4};
+    const utils::FloatRect intersectingBox{12, 12, 4, 4};
+    const utils::FloatRect touchingBox{14, 10, 4, 4};
+    const utils::FloatRect sameBox{10, 10, 4, 4};
+    const utils::FloatRect distantBox{0, 0, 2, 2};
+    const utils::FloatRect boxWithSameCentre{8, 8, 8, 8};
+    const utils::FloatRect containedBox{13, 13, 1, 1};
+    const utils::FloatRect boxIntersectingFromAbove{11, 5, 2, 6};
+    ColliderBoxes colliderBoxes;
+    std::vector<int> indices;
+};
+
+TEST_F(ColliderBoxesTest, givenNoBoxes_shouldNotReturnAnyIndices)
+{
+    colliderBoxes.getIndicesOfBoxesCollidingWith(box, indices);
+
+    ASSERT_TRUE(indices.empty());
+}
+
+TEST_F(ColliderBoxesTest, addedBox_shouldBeReturnedUnchanged)
+{
+    colliderBoxes.add(intersectingBox);
+
+    ASSERT_EQ(colliderBoxes.size(), 1u);
+    ASSERT_EQ(colliderBoxes.getBox(0), intersectingBox);
+}
+
+TEST_F(ColliderBoxesTest, clearedBoxes_shouldBeEmpty)
+{
+    colliderBoxes.add(intersectingBox);
+
+    colliderBoxes.clear();
+
+    ASSERT_EQ(colliderBoxes.size(), 0u);
+}
+
+TEST_F(ColliderBoxesTest, shouldReturnIndicesOfIntersectingBoxesWithDifferentCentresInOrder)
+{
+    for (const auto& otherBox : {intersectingBox, touchingBox, sameBox, distantBox, boxWithSameCentre,
+                                 containedBox, boxIntersectingFromAbove})
+    {
+        colliderBoxes.add(otherBox);
+    }
+
+    colliderBoxes.getIndicesOfBoxesCollidingWith(box, indices);
+
+    const std::vector<int> expectedIndices{0, 5, 6};
+    ASSERT_EQ(indices, expectedIndices);
+}
+
+TEST_F(ColliderBoxesTest, shouldAppendIndicesToGivenOnes)
+{
+    indices.push_back(7);
+    colliderBoxes.add(intersectingBox);
+
+    colliderBoxes.getIndicesOfBoxesCollidingWith(box, indices);
+
+    const std::vector<int> expectedIndices{7, 0};
+    ASSERT_EQ(indices, expectedIndices);
+}
+
+TEST_F(ColliderBoxesTest, collidingBoxes_shouldMatchIntersectionOfRectsWithDifferentCentres)
+{
+    std::mt19937 randomEngine{42};
+    std::uniform_int_distribution<int> positions{0, 30};
+    std::uniform_int_distribution<int> sizes{1, 6};
+    std::vector<utils::FloatRect> boxes;
+
+    for (int boxIndex = 0; boxIndex < 203; boxIndex++)
+    {
+        boxes.emplace_back(static_cast<float>(positions(randomEngine)) / 2.f,
+                           static_cast<float>(positions(randomEngine)) / 2.f,
+                           static_cast<float>(sizes(randomEngine)) / 2.f,
+                           static_cast<float>(sizes(randomEngine)) / 2.f);
+        colliderBoxes.add(boxes.back());
+    }
+
+    colliderBoxes.getIndicesOfBoxesCollidingWith(box, indices);
+
+    std::vector<int> expectedIndices;
+    for (int boxIndex = 0; boxIndex < static_cast<int>(boxes.size()); boxIndex++)
+    {
+        if (intersectsWithArea(box, boxes[boxIndex]))
+        {
+            expectedIndices.push_back(boxIndex);
+        }
+    }
+    ASSERT_FALSE(expectedIndices.empty());
+    ASSERT_EQ(indices, expectedIndices);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <array>
+
+#include "CollisionLayer.h"
+
+namespace physics
+{
+// for every layer, layers whose colliders block colliders from that layer
+inline constexpr std::array<components::core::CollisionLayerMask, 3> collisionLayerMatrix{
+    // Default
+    components::core::toCollisionLayerMask(components::core::CollisionLayer::Default),
+    // Player
+    components::core::toCollisionLayerMask(components::core::CollisionLayer::Default) |
+        components::core::toCollisionLayerMask(components::core::CollisionLayer::Player) |
+        components::core::toCollisionLayerMask(components::core::CollisionLayer::Tile),
+    // Tile
+    components::core::CollisionLayerMask{0}};
+
+constexpr components::core::CollisionLayerMask getLayersCollidingWith(components::core::CollisionLayer layer)
+{
+    return collisionLayerMatrix[static_cast<std::size_t>(layer)];
+}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace physics
+{
+struct CollisionSystemSettings
+{
+    int numberOfFramesToFallAsleep{60};
+    // 0 takes all hardware threads, 1 forces resolving every collider on calling thread
+    unsigned int numberOfThreads{0};
+    // colliders moving further than their size in one frame are swept, so they do not pass through obstacles
+    bool sweptCollisions{true};
+};
+}
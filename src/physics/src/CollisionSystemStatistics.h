@@ -0,0 +1,10 @@
+#pragma once
+
+namespace physics
+{
+struct CollisionSystemStatistics
+{
+    int numberOfAwakeColliders;
+    int numberOfSleepingColliders;
+};
+}
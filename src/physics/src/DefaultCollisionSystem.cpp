@@ -1,26 +1,74 @@
 #include "DefaultCollisionSystem.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "CollisionLayerMatrix.h"
 #include "MovementComponent.h"
+#include "SweptAabb.h"
 
 namespace physics
 {
 using namespace components::core;
 
-DefaultCollisionSystem::DefaultCollisionSystem(std::shared_ptr<Quadtree> quadtree)
-    : collisionTree{std::move(quadtree)}
+namespace
+{
+// boxes are compared to those stored when collider last changed, so slow drift wakes collider as well
+const auto maxBoxShiftOfUnchangedCollider = 0.01f;
+
+bool areBoxesClose(const utils::FloatRect& box, const utils::FloatRect& otherBox)
+{
+    return std::abs(box.left - otherBox.left) <= maxBoxShiftOfUnchangedCollider and
+           std::abs(box.top - otherBox.top) <= maxBoxShiftOfUnchangedCollider and
+           box.width == otherBox.width and box.height == otherBox.height;
+}
+
+// smaller chunks cost more in waking threads than they save
+const std::size_t minimumNumberOfCollidersPerChunk = 32;
+
+std::size_t getNumberOfThreads(unsigned int numberOfThreads)
+{
+    return numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads;
+}
+
+// collider moving by less than its size overlaps every obstacle on its way in current or next frame box
+bool canPassThroughObstacles(const utils::FloatRect& collisionBox,
+                             const utils::FloatRect& nextFrameCollisionBox)
+{
+    return std::abs(nextFrameCollisionBox.left - collisionBox.left) > collisionBox.width or
+           std::abs(nextFrameCollisionBox.top - collisionBox.top) > collisionBox.height;
+}
+
+utils::FloatRect getBoundingArea(const utils::FloatRect& box, const utils::FloatRect& otherBox)
 {
-    utils::Bitmask defaultCollisions{};
-    defaultCollisions.setBit(toInt(CollisionLayer::Default));
-    possibleCollisionsInLayers.insert(std::make_pair(CollisionLayer::Default, defaultCollisions));
+    const auto left = std::min(box.left, otherBox.left);
+    const auto top = std::min(box.top, otherBox.top);
+    const auto right = std::max(box.left + box.width, otherBox.left + otherBox.width);
+    const auto bottom = std::max(box.top + box.height, otherBox.top + otherBox.height);
+    return {left, top, right - left, bottom - top};
+}
 
-    const utils::Bitmask tileCollisions{};
-    possibleCollisionsInLayers.insert(std::make_pair(CollisionLayer::Tile, tileCollisions));
+utils::FloatRect getSweptArea(const utils::FloatRect& collisionBox,
+                              const utils::FloatRect& nextFrameCollisionBox)
+{
+    const auto left = std::min(collisionBox.left, nextFrameCollisionBox.left);
+    const auto top = std::min(collisionBox.top, nextFrameCollisionBox.top);
+    const auto right = std::max(collisionBox.left, nextFrameCollisionBox.left) + collisionBox.width;
+    const auto bottom = std::max(collisionBox.top, nextFrameCollisionBox.top) + collisionBox.height;
+    return {left, top, right - left, bottom - top};
+}
+}
 
-    utils::Bitmask playerCollisions{};
-    playerCollisions.setBit(toInt(CollisionLayer::Default));
-    playerCollisions.setBit(toInt(CollisionLayer::Tile));
-    playerCollisions.setBit(toInt(CollisionLayer::Player));
-    possibleCollisionsInLayers.insert(std::make_pair(CollisionLayer::Player, playerCollisions));
+DefaultCollisionSystem::DefaultCollisionSystem(std::shared_ptr<Quadtree> quadtree,
+                                               const CollisionSystemSettings& settings)
+    : collisionTree{std::move(quadtree)},
+      numberOfFramesToFallAsleep{settings.numberOfFramesToFallAsleep},
+      sweptCollisions{settings.sweptCollisions},
+      collisionPairsFound{false},
+      workerPool{getNumberOfThreads(settings.numberOfThreads)},
+      resolveContexts(workerPool.getNumberOfThreads())
+{
 }
 
 void DefaultCollisionSystem::add(std::vector<std::shared_ptr<components::core::ComponentOwner>>& owners)
@@ -39,6 +87,9 @@ void DefaultCollisionSystem::add(std::vector<std::shared_ptr<components::core::C
             {
                 collidersPerLayers.insert({collisionLayer, {collider}});
             }
+
+            collisionTree->insertCollider(collider);
+            addColliderBoxesIndex(collider.get());
         }
     }
 }
@@ -49,31 +100,202 @@ void DefaultCollisionSystem::processRemovals()
     {
         collidersInCollisionLayer.erase(
             std::remove_if(collidersInCollisionLayer.begin(), collidersInCollisionLayer.end(),
-                           [](auto& collider) { return collider->shouldBeRemoved(); }),
+                           [this](auto& collider)
+                           {
+                               if (not collider->shouldBeRemoved())
+                               {
+                                   return false;
+                               }
+
+                               // colliders resting against removed one may be able to move again
+                               wakeCollidersInArea(collider->getCollisionBox());
+                               collisionTree->removeCollider(collider);
+                               removeColliderBoxesIndex(collider.get());
+                               return true;
+                           }),
             collidersInCollisionLayer.end());
     }
 }
 
 void DefaultCollisionSystem::update()
 {
-    collisionTree->clearAllColliders();
-
     for (const auto& [_, collidersInCollisionLayer] : collidersPerLayers)
     {
         for (const auto& colliderInCollisionLayer : collidersInCollisionLayer)
         {
-            collisionTree->insertCollider(colliderInCollisionLayer);
+            collisionTree->updateCollider(colliderInCollisionLayer);
         }
     }
 
+    updateColliderBoxes();
+    updateColliderActivities();
+    updateCollisionPartners();
     resolve();
 }
 
+CollisionSystemStatistics DefaultCollisionSystem::getStatistics() const
+{
+    return statistics;
+}
+
+void DefaultCollisionSystem::addColliderBoxesIndex(components::core::BoxColliderComponent* collider)
+{
+    if (indicesOfColliderBoxes.contains(collider))
+    {
+        return;
+    }
+
+    indicesOfColliderBoxes.insert({collider, static_cast<int>(collidersWithBoxes.size())});
+    collidersWithBoxes.push_back(collider);
+    colliderActivities.emplace_back();
+}
+
+void DefaultCollisionSystem::removeColliderBoxesIndex(const components::core::BoxColliderComponent* collider)
+{
+    const auto colliderIndex = indicesOfColliderBoxes.find(collider);
+
+    if (colliderIndex == indicesOfColliderBoxes.end())
+    {
+        return;
+    }
+
+    const auto lastCollider = collidersWithBoxes.back();
+    collidersWithBoxes[colliderIndex->second] = lastCollider;
+    colliderActivities[colliderIndex->second] = colliderActivities.back();
+    indicesOfColliderBoxes[lastCollider] = colliderIndex->second;
+    collidersWithBoxes.pop_back();
+    colliderActivities.pop_back();
+    indicesOfColliderBoxes.erase(collider);
+}
+
+void DefaultCollisionSystem::updateColliderBoxes()
+{
+    nextFrameXCollisionBoxes.clear();
+    nextFrameYCollisionBoxes.clear();
+
+    for (const auto collider : collidersWithBoxes)
+    {
+        nextFrameXCollisionBoxes.add(collider->getNextFrameXCollisionBox());
+        nextFrameYCollisionBoxes.add(collider->getNextFrameYCollisionBox());
+    }
+}
+
+void DefaultCollisionSystem::updateColliderActivities()
+{
+    for (std::size_t colliderIndex = 0; colliderIndex < colliderActivities.size(); colliderIndex++)
+    {
+        auto& activity = colliderActivities[colliderIndex];
+        const auto nextFrameXCollisionBox = nextFrameXCollisionBoxes.getBox(colliderIndex);
+        const auto nextFrameYCollisionBox = nextFrameYCollisionBoxes.getBox(colliderIndex);
+
+        // boxes change together with position or velocity of collider
+        if (areBoxesClose(activity.nextFrameXCollisionBox, nextFrameXCollisionBox) and
+            areBoxesClose(activity.nextFrameYCollisionBox, nextFrameYCollisionBox))
+        {
+            activity.numberOfFramesWithoutChange++;
+            continue;
+        }
+
+        // colliders of all layers around previous and current boxes are woken, so none of them keeps
+        // movement directions resolved against old boxes of collider which moved, left or entered its area
+        auto changedArea = getBoundingArea(nextFrameXCollisionBox, nextFrameYCollisionBox);
+
+        if (activity.hasBoxes)
+        {
+            const auto previousArea =
+                getBoundingArea(activity.nextFrameXCollisionBox, activity.nextFrameYCollisionBox);
+            changedArea = getBoundingArea(changedArea, previousArea);
+        }
+
+        wakeCollidersInArea(changedArea);
+
+        activity.nextFrameXCollisionBox = nextFrameXCollisionBox;
+        activity.nextFrameYCollisionBox = nextFrameYCollisionBox;
+        activity.hasBoxes = true;
+        activity.numberOfFramesWithoutChange = 0;
+        activity.asleep = false;
+    }
+}
+
+void DefaultCollisionSystem::updateCollisionPartners()
+{
+    collisionPairs.clear();
+    collisionPairsFound = collisionTree->getPossibleCollisionPairs(collisionPairs);
+
+    if (not collisionPairsFound)
+    {
+        return;
+    }
+
+    firstCollisionPartnerIndices.assign(collidersWithBoxes.size() + 1, 0);
+
+    for (const auto& [collider, otherCollider] : collisionPairs)
+    {
+        if (const auto colliderIndex = indicesOfColliderBoxes.find(collider);
+            colliderIndex != indicesOfColliderBoxes.end())
+        {
+            firstCollisionPartnerIndices[colliderIndex->second + 1]++;
+        }
+
+        if (const auto colliderIndex = indicesOfColliderBoxes.find(otherCollider);
+            colliderIndex != indicesOfColliderBoxes.end())
+        {
+            firstCollisionPartnerIndices[colliderIndex->second + 1]++;
+        }
+    }
+
+    std::partial_sum(firstCollisionPartnerIndices.begin(), firstCollisionPartnerIndices.end(),
+                     firstCollisionPartnerIndices.begin());
+    nextCollisionPartnerIndices = firstCollisionPartnerIndices;
+    collisionPartners.resize(firstCollisionPartnerIndices.back());
+
+    for (const auto& [collider, otherCollider] : collisionPairs)
+    {
+        addCollisionPartner(collider, otherCollider);
+        addCollisionPartner(otherCollider, collider);
+    }
+}
+
+void DefaultCollisionSystem::addCollisionPartner(const components::core::BoxColliderComponent* collider,
+                                                 components::core::BoxColliderComponent* partner)
+{
+    if (const auto colliderIndex = indicesOfColliderBoxes.find(collider);
+        colliderIndex != indicesOfColliderBoxes.end())
+    {
+        collisionPartners[nextCollisionPartnerIndices[colliderIndex->second]++] = partner;
+    }
+}
+
+void DefaultCollisionSystem::wakeCollidersInArea(const utils::FloatRect& area)
+{
+    possibleCollisions.clear();
+    collisionTree->getPossibleCollidersInArea(area, possibleCollisions);
+
+    for (const auto possibleCollision : possibleCollisions)
+    {
+        if (const auto colliderIndex = indicesOfColliderBoxes.find(possibleCollision);
+            colliderIndex != indicesOfColliderBoxes.end())
+        {
+            wakeCollider(colliderIndex->second);
+        }
+    }
+}
+
+void DefaultCollisionSystem::wakeCollider(int colliderIndex)
+{
+    auto& activity = colliderActivities[colliderIndex];
+    activity.numberOfFramesWithoutChange = 0;
+    activity.asleep = false;
+}
+
 void DefaultCollisionSystem::resolve()
 {
+    statistics = {};
+    indicesOfCollidersToResolve.clear();
+
     for (const auto& [collisionLayer, collidersInCollisionLayer] : collidersPerLayers)
     {
-        if (possibleCollisionsInLayers[collisionLayer].getMask() == 0)
+        if (getLayersCollidingWith(collisionLayer) == 0)
         {
             continue;
         }
@@ -90,53 +312,204 @@ void DefaultCollisionSystem::resolve()
                 continue;
             }
 
-            collider->setAvailableMovementDirections();
-
-            const auto xCollisions =
-                collisionTree->getCollidersIntersectingWithAreaFromX(collider->getNextFrameXCollisionBox());
+            const auto colliderIndex = indicesOfColliderBoxes.at(collider.get());
 
-            for (const auto& xCollision : xCollisions)
+            // sleeping collider keeps movement directions from last resolving
+            if (colliderActivities[colliderIndex].asleep)
             {
-                if (collider->getOwnerId() == xCollision->getOwnerId() or not xCollision->isEnabled())
-                {
-                    continue;
-                }
-
-                const auto layersCollide = possibleCollisionsInLayers[collider->getCollisionLayer()].isBitSet(
-                    (toInt(xCollision->getCollisionLayer())));
-
-                if (layersCollide)
-                {
-                    if (collider->intersectsX(xCollision))
-                    {
-                        collider->resolveOverlapX(xCollision);
-                    }
-                }
+                statistics.numberOfSleepingColliders++;
+                continue;
             }
 
-            const auto yCollisions =
-                collisionTree->getCollidersIntersectingWithAreaFromY(collider->getNextFrameYCollisionBox());
+            indicesOfCollidersToResolve.push_back(colliderIndex);
+        }
+    }
+
+    statistics.numberOfAwakeColliders = static_cast<int>(indicesOfCollidersToResolve.size());
 
-            for (const auto& yCollision : yCollisions)
-            {
-                if (collider->getOwnerId() == yCollision->getOwnerId() or not yCollision->isEnabled())
-                {
-                    continue;
-                }
-
-                const auto layersCollide = possibleCollisionsInLayers[collider->getCollisionLayer()].isBitSet(
-                    (toInt(yCollision->getCollisionLayer())));
-
-                if (layersCollide)
-                {
-                    if (collider->intersectsY(yCollision))
-                    {
-                        collider->resolveOverlapY(yCollision);
-                    }
-                }
-            }
+    // collider changes only its own state while resolving, so chunks give same results in any order
+    const auto numberOfChunks = std::clamp<std::size_t>(
+        indicesOfCollidersToResolve.size() / minimumNumberOfCollidersPerChunk, 1, resolveContexts.size());
+    const auto numberOfCollidersPerChunk =
+        (indicesOfCollidersToResolve.size() + numberOfChunks - 1) / numberOfChunks;
+
+    workerPool.run(numberOfChunks,
+                   [&](std::size_t chunkIndex)
+                   {
+                       auto& resolveContext = resolveContexts[chunkIndex];
+                       const auto firstIndex = chunkIndex * numberOfCollidersPerChunk;
+                       const auto lastIndex = std::min(indicesOfCollidersToResolve.size(),
+                                                       firstIndex + numberOfCollidersPerChunk);
+
+                       for (auto index = firstIndex; index < lastIndex; index++)
+                       {
+                           resolveCollider(indicesOfCollidersToResolve[index], resolveContext);
+                       }
+                   });
+}
+
+void DefaultCollisionSystem::resolveCollider(int colliderIndex, ResolveContext& resolveContext)
+{
+    auto& collider = *collidersWithBoxes[colliderIndex];
+    auto& activity = colliderActivities[colliderIndex];
+
+    collider.setAvailableMovementDirections();
+
+    const auto layersCollidingWithCollider = getLayersCollidingWith(collider.getCollisionLayer());
+
+    const auto nextFrameXCollisionBox = nextFrameXCollisionBoxes.getBox(colliderIndex);
+    collectPossibleCollisions(colliderIndex, nextFrameXCollisionBox, layersCollidingWithCollider,
+                              resolveContext);
+    auto numberOfPossibleCollisions = resolveContext.possibleCollisions.size();
+    collectCollisionCandidates(collider, nextFrameXCollisionBoxes, resolveContext);
+    resolveContext.collisionIndices.clear();
+    resolveContext.collisionCandidatesBoxes.getIndicesOfBoxesCollidingWith(nextFrameXCollisionBox,
+                                                                          resolveContext.collisionIndices);
+
+    // overlap is resolved against next frame box computed last by collider
+    collider.getNextFrameXCollisionBox();
+
+    for (const auto collisionIndex : resolveContext.collisionIndices)
+    {
+        collider.resolveOverlapX(
+            *resolveContext.collisionCandidates[collisionIndex],
+            nextFrameXCollisionBoxes.getBox(resolveContext.indicesOfCandidatesBoxes[collisionIndex]));
+    }
+
+    const auto collisionBox = collider.getCollisionBox();
+
+    if (sweptCollisions and canPassThroughObstacles(collisionBox, nextFrameXCollisionBox))
+    {
+        if (const auto sweptHit =
+                findEarliestSweptHit(collider, collisionBox, nextFrameXCollisionBox, nextFrameXCollisionBoxes,
+                                     colliderIndex, resolveContext))
+        {
+            collider.resolveSweptHitX(*sweptHit->collider, sweptHit->timeOfImpact.normal);
+        }
+    }
+
+    const auto nextFrameYCollisionBox = nextFrameYCollisionBoxes.getBox(colliderIndex);
+    collectPossibleCollisions(colliderIndex, nextFrameYCollisionBox, layersCollidingWithCollider,
+                              resolveContext);
+    numberOfPossibleCollisions += resolveContext.possibleCollisions.size();
+    collectCollisionCandidates(collider, nextFrameYCollisionBoxes, resolveContext);
+    resolveContext.collisionIndices.clear();
+    resolveContext.collisionCandidatesBoxes.getIndicesOfBoxesCollidingWith(nextFrameYCollisionBox,
+                                                                          resolveContext.collisionIndices);
+
+    collider.getNextFrameYCollisionBox();
+
+    for (const auto collisionIndex : resolveContext.collisionIndices)
+    {
+        collider.resolveOverlapY(
+            *resolveContext.collisionCandidates[collisionIndex],
+            nextFrameXCollisionBoxes.getBox(resolveContext.indicesOfCandidatesBoxes[collisionIndex]));
+    }
+
+    if (sweptCollisions and canPassThroughObstacles(collisionBox, nextFrameYCollisionBox))
+    {
+        if (const auto sweptHit =
+                findEarliestSweptHit(collider, collisionBox, nextFrameYCollisionBox, nextFrameYCollisionBoxes,
+                                     colliderIndex, resolveContext))
+        {
+            collider.resolveSweptHitY(sweptHit->timeOfImpact.normal);
+        }
+    }
+
+    if (numberOfPossibleCollisions != activity.numberOfPossibleCollisions)
+    {
+        activity.numberOfPossibleCollisions = numberOfPossibleCollisions;
+        activity.numberOfFramesWithoutChange = 0;
+    }
+
+    activity.asleep = activity.numberOfFramesWithoutChange >= numberOfFramesToFallAsleep;
+}
+
+void DefaultCollisionSystem::collectPossibleCollisions(int colliderIndex, const utils::FloatRect& area,
+                                                       CollisionLayerMask layerMask,
+                                                       ResolveContext& resolveContext) const
+{
+    resolveContext.possibleCollisions.clear();
+
+    if (not collisionPairsFound)
+    {
+        collisionTree->getPossibleCollidersInArea(area, resolveContext.possibleCollisions, layerMask);
+        return;
+    }
+
+    // pairs are swept over boxes of current and next frame, so they cover every area collider is resolved in
+    for (auto partnerIndex = firstCollisionPartnerIndices[colliderIndex];
+         partnerIndex < firstCollisionPartnerIndices[colliderIndex + 1]; partnerIndex++)
+    {
+        const auto partner = collisionPartners[partnerIndex];
+
+        if (toCollisionLayerMask(partner->getCollisionLayer()) & layerMask)
+        {
+            resolveContext.possibleCollisions.push_back(partner);
         }
     }
+
+    if (layerMask & toCollisionLayerMask(CollisionLayer::Tile))
+    {
+        collisionTree->getPossibleStaticCollidersInArea(area, resolveContext.possibleCollisions);
+    }
+}
+
+void DefaultCollisionSystem::collectCollisionCandidates(const BoxColliderComponent& collider,
+                                                        const ColliderBoxes& nextFrameCollisionBoxes,
+                                                        ResolveContext& resolveContext) const
+{
+    resolveContext.collisionCandidates.clear();
+    resolveContext.indicesOfCandidatesBoxes.clear();
+    resolveContext.collisionCandidatesBoxes.clear();
+
+    for (const auto possibleCollision : resolveContext.possibleCollisions)
+    {
+        if (collider.getOwnerId() == possibleCollision->getOwnerId() or not possibleCollision->isEnabled())
+        {
+            continue;
+        }
+
+        const auto possibleCollisionIndex = indicesOfColliderBoxes.find(possibleCollision);
+
+        if (possibleCollisionIndex == indicesOfColliderBoxes.end())
+        {
+            continue;
+        }
+
+        resolveContext.collisionCandidates.push_back(possibleCollision);
+        resolveContext.indicesOfCandidatesBoxes.push_back(possibleCollisionIndex->second);
+        resolveContext.collisionCandidatesBoxes.add(
+            nextFrameCollisionBoxes.getBox(possibleCollisionIndex->second));
+    }
+}
+
+std::optional<DefaultCollisionSystem::SweptHit> DefaultCollisionSystem::findEarliestSweptHit(
+    const BoxColliderComponent& collider, const utils::FloatRect& collisionBox,
+    const utils::FloatRect& nextFrameCollisionBox, const ColliderBoxes& nextFrameCollisionBoxes,
+    int colliderIndex, ResolveContext& resolveContext) const
+{
+    collectPossibleCollisions(colliderIndex, getSweptArea(collisionBox, nextFrameCollisionBox),
+                              getLayersCollidingWith(collider.getCollisionLayer()), resolveContext);
+    collectCollisionCandidates(collider, nextFrameCollisionBoxes, resolveContext);
+
+    const utils::Vector2f displacement{nextFrameCollisionBox.left - collisionBox.left,
+                                       nextFrameCollisionBox.top - collisionBox.top};
+    std::optional<SweptHit> earliestHit;
+
+    for (std::size_t candidateIndex = 0; candidateIndex < resolveContext.collisionCandidates.size();
+         candidateIndex++)
+    {
+        const auto timeOfImpact = getTimeOfImpact(
+            collisionBox, displacement, resolveContext.collisionCandidatesBoxes.getBox(candidateIndex));
+
+        if (timeOfImpact and (not earliestHit or timeOfImpact->time < earliestHit->timeOfImpact.time))
+        {
+            earliestHit = SweptHit{resolveContext.collisionCandidates[candidateIndex], *timeOfImpact};
+        }
+    }
+
+    return earliestHit;
 }
 
 }
\ No newline at end of file
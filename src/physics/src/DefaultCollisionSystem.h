@@ -2,32 +2,92 @@
 
 #include <map>
 #include <memory>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
-#include "Bitmask.h"
 #include "BoxColliderComponent.h"
+#include "ColliderActivity.h"
+#include "ColliderBoxes.h"
 #include "CollisionLayer.h"
 #include "CollisionSystem.h"
+#include "CollisionSystemSettings.h"
+#include "CollisionSystemStatistics.h"
 #include "Quadtree.h"
+#include "TimeOfImpact.h"
+#include "WorkerPool.h"
 
 namespace physics
 {
 class DefaultCollisionSystem : public CollisionSystem
 {
 public:
-    explicit DefaultCollisionSystem(std::shared_ptr<Quadtree>);
+    explicit DefaultCollisionSystem(std::shared_ptr<Quadtree>, const CollisionSystemSettings& = {});
 
     void add(std::vector<std::shared_ptr<components::core::ComponentOwner>>&) override;
     void processRemovals() override;
     void update() override;
+    CollisionSystemStatistics getStatistics() const;
 
 private:
+    // scratch buffers of one chunk of resolved colliders, chunks are resolved in parallel
+    struct ResolveContext
+    {
+        std::vector<components::core::BoxColliderComponent*> possibleCollisions;
+        std::vector<components::core::BoxColliderComponent*> collisionCandidates;
+        std::vector<int> indicesOfCandidatesBoxes;
+        ColliderBoxes collisionCandidatesBoxes;
+        std::vector<int> collisionIndices;
+    };
+
+    struct SweptHit
+    {
+        components::core::BoxColliderComponent* collider;
+        TimeOfImpact timeOfImpact;
+    };
+
+    void addColliderBoxesIndex(components::core::BoxColliderComponent*);
+    void removeColliderBoxesIndex(const components::core::BoxColliderComponent*);
+    void updateColliderBoxes();
+    void updateColliderActivities();
+    void updateCollisionPartners();
+    void addCollisionPartner(const components::core::BoxColliderComponent* collider,
+                             components::core::BoxColliderComponent* partner);
+    void wakeCollidersInArea(const utils::FloatRect&);
+    void wakeCollider(int colliderIndex);
     void resolve();
+    void resolveCollider(int colliderIndex, ResolveContext&);
+    void collectPossibleCollisions(int colliderIndex, const utils::FloatRect& area,
+                                   components::core::CollisionLayerMask, ResolveContext&) const;
+    void collectCollisionCandidates(const components::core::BoxColliderComponent&,
+                                    const ColliderBoxes& nextFrameCollisionBoxes, ResolveContext&) const;
+    std::optional<SweptHit> findEarliestSweptHit(const components::core::BoxColliderComponent&,
+                                                 const utils::FloatRect& collisionBox,
+                                                 const utils::FloatRect& nextFrameCollisionBox,
+                                                 const ColliderBoxes& nextFrameCollisionBoxes,
+                                                 int colliderIndex, ResolveContext&) const;
 
-    std::map<components::core::CollisionLayer, utils::Bitmask> possibleCollisionsInLayers;
     std::map<components::core::CollisionLayer,
              std::vector<std::shared_ptr<components::core::BoxColliderComponent>>>
         collidersPerLayers;
     std::shared_ptr<Quadtree> collisionTree;
+    std::unordered_map<const components::core::BoxColliderComponent*, int> indicesOfColliderBoxes;
+    std::vector<components::core::BoxColliderComponent*> collidersWithBoxes;
+    std::vector<ColliderActivity> colliderActivities;
+    const int numberOfFramesToFallAsleep;
+    const bool sweptCollisions;
+    CollisionSystemStatistics statistics{};
+    ColliderBoxes nextFrameXCollisionBoxes;
+    ColliderBoxes nextFrameYCollisionBoxes;
+    std::vector<components::core::BoxColliderComponent*> possibleCollisions;
+    std::vector<int> indicesOfCollidersToResolve;
+    std::vector<Quadtree::CollisionPair> collisionPairs;
+    bool collisionPairsFound;
+    // partners of collider with index i are stored from firstCollisionPartnerIndices[i] to that of i + 1
+    std::vector<std::size_t> firstCollisionPartnerIndices;
+    std::vector<std::size_t> nextCollisionPartnerIndices;
+    std::vector<components::core::BoxColliderComponent*> collisionPartners;
+    WorkerPool workerPool;
+    std::vector<ResolveContext> resolveContexts;
 };
 }
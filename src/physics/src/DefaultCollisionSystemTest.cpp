@@ -3,6 +3,7 @@
 #include "gtest/gtest.h"
 
 #include "AnimatorMock.h"
+#include "InputMock.h"
 #include "RendererPoolMock.h"
 
 #include "AnimationComponent.h"
@@ -10,7 +11,10 @@
 #include "DefaultRayCast.h"
 #include "DirectionComponent.h"
 #include "KeyboardAnimatedMovementComponent.h"
+#include "SpatialHashGrid.h"
+#include "StaticGridQuadtree.h"
 #include "StlOperators.h"
+#include "SweepAndPrune.h"
 
 using namespace physics;
 using namespace components::core;
@@ -113,9 +117,37 @@ public:
         return movementComponent->isAllowedToMoveDown();
     }
 
+    static std::vector<bool> getAllowedMovements(const std::vector<std::shared_ptr<ComponentOwner>>& owners)
+    {
+        std::vector<bool> allowedMovements;
+
+        for (const auto& owner : owners)
+        {
+            allowedMovements.insert(allowedMovements.end(), {canMoveLeft(owner), canMoveRight(owner),
+                                                             canMoveUp(owner), canMoveDown(owner)});
+        }
+
+        return allowedMovements;
+    }
+
+    std::shared_ptr<ComponentOwner> createOwnerWithDefaultCollider(const utils::Vector2f& position,
+                                                                   const std::string& name)
+    {
+        auto componentOwner = std::make_shared<ComponentOwner>(position, name, sharedContext);
+        auto movementComponent = componentOwner->addComponent<KeyboardAnimatedMovementComponent>();
+        componentOwner->addComponent<BoxColliderComponent>(size, CollisionLayer::Default,
+                                                           utils::Vector2f{0, 0}, movementComponent);
+        componentOwner->addComponent<AnimationComponent>(animator);
+        componentOwner->addComponent<VelocityComponent>(6);
+        componentOwner->addComponent<DirectionComponent>();
+        componentOwner->loadDependentComponents();
+        return componentOwner;
+    }
+
     const utils::Vector2f size{5, 5};
     const utils::Vector2f position1{20, 20};
     const utils::Vector2f position2{24, 23};
+    const utils::FloatRect bounds{0, 0, 160, 120};
     std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
         std::make_shared<NiceMock<graphics::RendererPoolMock>>();
     std::shared_ptr<components::core::SharedContext> sharedContext =
@@ -138,6 +170,7 @@ public:
         std::make_shared<ComponentOwner>(position2, "collisionSystemTest8", sharedContext);
     std::shared_ptr<NiceMock<animations::AnimatorMock>> animator =
         std::make_shared<NiceMock<animations::AnimatorMock>>();
+    NiceMock<input::InputMock> input;
 
     std::shared_ptr<physics::Quadtree> quadtree = std::make_shared<physics::DefaultQuadtree>();
     std::shared_ptr<physics::RayCast> rayCast = std::make_shared<physics::DefaultRayCast>(quadtree);
@@ -324,3 +357,305 @@ TEST_F(DefaultCollisionSystemTest, givenTwoSameColliders_shouldNotBlockAnyMoveme
     ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
                 canMoveRight(componentOwners[0]) && canMoveDown(componentOwners[0]));
 }
+
+TEST_F(DefaultCollisionSystemTest, removedCollider_shouldNotBlockAnyMovements)
+{
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystem.add(componentOwners);
+    collisionSystem.update();
+
+    componentOwnerWithDefaultCollider2->remove();
+    collisionSystem.processRemovals();
+    collisionSystem.update();
+
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveRight(componentOwners[0]) && canMoveDown(componentOwners[0]));
+}
+
+TEST_F(DefaultCollisionSystemTest, colliderMovedAwayFromOtherCollider_shouldNotBlockAnyMovements)
+{
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystem.add(componentOwners);
+    collisionSystem.update();
+
+    componentOwnerWithDefaultCollider2->transform->setPosition(utils::Vector2f{100, 50});
+    collisionSystem.update();
+
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveRight(componentOwners[0]) && canMoveDown(componentOwners[0]));
+}
+
+TEST_F(DefaultCollisionSystemTest, collidersWithUnchangedBoxesAndSurroundings_shouldFallAsleep)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    collisionSystemWithShortSleepDelay.update();
+    const auto statisticsAfterFirstUpdate = collisionSystemWithShortSleepDelay.getStatistics();
+    collisionSystemWithShortSleepDelay.update();
+    collisionSystemWithShortSleepDelay.update();
+    collisionSystemWithShortSleepDelay.update();
+    const auto statisticsAfterFourUpdates = collisionSystemWithShortSleepDelay.getStatistics();
+
+    ASSERT_EQ(statisticsAfterFirstUpdate.numberOfAwakeColliders, 2);
+    ASSERT_EQ(statisticsAfterFirstUpdate.numberOfSleepingColliders, 0);
+    ASSERT_EQ(statisticsAfterFourUpdates.numberOfAwakeColliders, 0);
+    ASSERT_EQ(statisticsAfterFourUpdates.numberOfSleepingColliders, 2);
+}
+
+TEST_F(DefaultCollisionSystemTest, sleepingCollider_shouldKeepBlockedMovements)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        collisionSystemWithShortSleepDelay.update();
+    }
+
+    ASSERT_EQ(collisionSystemWithShortSleepDelay.getStatistics().numberOfSleepingColliders, 2);
+    ASSERT_FALSE(canMoveRight(componentOwnerWithDefaultCollider1) &&
+                 canMoveDown(componentOwnerWithDefaultCollider1));
+}
+
+TEST_F(DefaultCollisionSystemTest, colliderMovedAwayFromSleepingCollider_shouldWakeItAndUnblockMovements)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        collisionSystemWithShortSleepDelay.update();
+    }
+
+    componentOwnerWithDefaultCollider2->transform->setPosition(utils::Vector2f{100, 50});
+    collisionSystemWithShortSleepDelay.update();
+
+    ASSERT_EQ(collisionSystemWithShortSleepDelay.getStatistics().numberOfAwakeColliders, 2);
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveRight(componentOwners[0]) && canMoveDown(componentOwners[0]));
+}
+
+TEST_F(DefaultCollisionSystemTest, colliderEnteringAreaOfSleepingCollider_shouldWakeIt)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    componentOwnerWithDefaultCollider2->transform->setPosition(utils::Vector2f{100, 50});
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        collisionSystemWithShortSleepDelay.update();
+    }
+
+    componentOwnerWithDefaultCollider2->transform->setPosition(position2);
+    collisionSystemWithShortSleepDelay.update();
+
+    ASSERT_EQ(collisionSystemWithShortSleepDelay.getStatistics().numberOfAwakeColliders, 2);
+    ASSERT_FALSE(canMoveRight(componentOwnerWithDefaultCollider1) &&
+                 canMoveDown(componentOwnerWithDefaultCollider1));
+}
+
+TEST_F(DefaultCollisionSystemTest, colliderNotBlockedBySleepingPlayerCollider_shouldWakeItWhenEnteringItsArea)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    componentOwnerWithDefaultCollider2->transform->setPosition(utils::Vector2f{100, 50});
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithPlayerCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        collisionSystemWithShortSleepDelay.update();
+    }
+
+    componentOwnerWithDefaultCollider2->transform->setPosition(position2);
+    collisionSystemWithShortSleepDelay.update();
+
+    ASSERT_EQ(collisionSystemWithShortSleepDelay.getStatistics().numberOfAwakeColliders, 2);
+    ASSERT_FALSE(canMoveRight(componentOwnerWithPlayerCollider1) &&
+                 canMoveDown(componentOwnerWithPlayerCollider1));
+}
+
+TEST_F(DefaultCollisionSystemTest, tileColliderEnteringAreaOfSleepingCollider_shouldWakeIt)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    componentOwnerWithTileCollider2->transform->setPosition(utils::Vector2f{100, 50});
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithPlayerCollider1,
+                                                                 componentOwnerWithTileCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        collisionSystemWithShortSleepDelay.update();
+    }
+
+    componentOwnerWithTileCollider2->transform->setPosition(position2);
+    collisionSystemWithShortSleepDelay.update();
+
+    ASSERT_EQ(collisionSystemWithShortSleepDelay.getStatistics().numberOfAwakeColliders, 1);
+    ASSERT_FALSE(canMoveRight(componentOwnerWithPlayerCollider1) &&
+                 canMoveDown(componentOwnerWithPlayerCollider1));
+}
+
+TEST_F(DefaultCollisionSystemTest, removedNeighbourOfSleepingCollider_shouldWakeItAndUnblockMovements)
+{
+    DefaultCollisionSystem collisionSystemWithShortSleepDelay{quadtree, {.numberOfFramesToFallAsleep = 2}};
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithDefaultCollider1,
+                                                                 componentOwnerWithDefaultCollider2};
+    collisionSystemWithShortSleepDelay.add(componentOwners);
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        collisionSystemWithShortSleepDelay.update();
+    }
+
+    componentOwnerWithDefaultCollider2->remove();
+    collisionSystemWithShortSleepDelay.processRemovals();
+    collisionSystemWithShortSleepDelay.update();
+
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveRight(componentOwners[0]) && canMoveDown(componentOwners[0]));
+}
+
+TEST_F(DefaultCollisionSystemTest, resolvingOnManyThreads_shouldBlockSameMovementsAsResolvingOnSingleThread)
+{
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners;
+    for (int ownerIndex = 0; ownerIndex < 200; ownerIndex++)
+    {
+        const auto column = static_cast<float>(ownerIndex % 20);
+        const auto row = static_cast<float>(ownerIndex / 20);
+        const utils::Vector2f position{column * 4.f + static_cast<float>(ownerIndex % 3), row * 6.f};
+        componentOwners.push_back(createOwnerWithDefaultCollider(
+            position, "collisionSystemManyThreadsTest" + std::to_string(ownerIndex)));
+    }
+    DefaultCollisionSystem singleThreadedCollisionSystem{quadtree, {.numberOfThreads = 1}};
+    DefaultCollisionSystem multiThreadedCollisionSystem{std::make_shared<physics::DefaultQuadtree>(),
+                                                        {.numberOfThreads = 4}};
+    singleThreadedCollisionSystem.add(componentOwners);
+    multiThreadedCollisionSystem.add(componentOwners);
+
+    singleThreadedCollisionSystem.update();
+    const auto movementsAllowedBySingleThread = getAllowedMovements(componentOwners);
+    multiThreadedCollisionSystem.update();
+    const auto movementsAllowedByManyThreads = getAllowedMovements(componentOwners);
+
+    ASSERT_NE(std::ranges::count(movementsAllowedBySingleThread, false), 0);
+    ASSERT_EQ(movementsAllowedByManyThreads, movementsAllowedBySingleThread);
+}
+
+TEST_F(DefaultCollisionSystemTest, fastColliderPassingThroughTileWithinOneFrame_shouldBlockMovementToTile)
+{
+    componentOwnerWithPlayerCollider1->transform->setPosition(utils::Vector2f{0, 20});
+    componentOwnerWithTileCollider2->transform->setPosition(utils::Vector2f{20, 20});
+    componentOwnerWithPlayerCollider1->getComponent<VelocityComponent>()->setVelocity(6, 0);
+    const auto playerCollider = componentOwnerWithPlayerCollider1->getComponent<BoxColliderComponent>();
+    playerCollider->update(utils::DeltaTime{5}, input);
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithPlayerCollider1,
+                                                                 componentOwnerWithTileCollider2};
+    collisionSystem.add(componentOwners);
+
+    collisionSystem.update();
+
+    ASSERT_FALSE(canMoveRight(componentOwners[0]));
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveDown(componentOwners[0]));
+}
+
+TEST_F(DefaultCollisionSystemTest, fastColliderPassingThroughTileWithoutSweeping_shouldNotBlockMovements)
+{
+    DefaultCollisionSystem discreteCollisionSystem{quadtree, {.sweptCollisions = false}};
+    componentOwnerWithPlayerCollider1->transform->setPosition(utils::Vector2f{0, 20});
+    componentOwnerWithTileCollider2->transform->setPosition(utils::Vector2f{20, 20});
+    componentOwnerWithPlayerCollider1->getComponent<VelocityComponent>()->setVelocity(6, 0);
+    const auto playerCollider = componentOwnerWithPlayerCollider1->getComponent<BoxColliderComponent>();
+    playerCollider->update(utils::DeltaTime{5}, input);
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithPlayerCollider1,
+                                                                 componentOwnerWithTileCollider2};
+    discreteCollisionSystem.add(componentOwners);
+
+    discreteCollisionSystem.update();
+
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveRight(componentOwners[0]) && canMoveDown(componentOwners[0]));
+}
+
+TEST_F(DefaultCollisionSystemTest, fastFallingColliderPassingThroughTile_shouldBlockDownMovement)
+{
+    componentOwnerWithPlayerCollider1->transform->setPosition(utils::Vector2f{20, 0});
+    componentOwnerWithTileCollider2->transform->setPosition(utils::Vector2f{20, 20});
+    componentOwnerWithPlayerCollider1->getComponent<VelocityComponent>()->setVelocity(0, 6);
+    const auto playerCollider = componentOwnerWithPlayerCollider1->getComponent<BoxColliderComponent>();
+    playerCollider->update(utils::DeltaTime{5}, input);
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithPlayerCollider1,
+                                                                 componentOwnerWithTileCollider2};
+    collisionSystem.add(componentOwners);
+
+    collisionSystem.update();
+
+    ASSERT_FALSE(canMoveDown(componentOwners[0]));
+    ASSERT_TRUE(canMoveLeft(componentOwners[0]) && canMoveUp(componentOwners[0]) &&
+                canMoveRight(componentOwners[0]));
+}
+
+
+TEST_F(DefaultCollisionSystemTest, staticTileWithSweptPairs_shouldBlockRightAndDownMovementsOfPlayer)
+{
+    const auto staticTile =
+        std::make_shared<ComponentOwner>(position2, "collisionSystemTest9", sharedContext);
+    staticTile->addComponent<BoxColliderComponent>(size, CollisionLayer::Tile);
+    DefaultCollisionSystem sweptCollisionSystem{
+        std::make_shared<StaticGridQuadtree>(std::make_unique<SweepAndPrune>(bounds), bounds)};
+    std::vector<std::shared_ptr<ComponentOwner>> componentOwners{componentOwnerWithPlayerCollider1,
+                                                                 staticTile};
+    sweptCollisionSystem.add(componentOwners);
+
+    sweptCollisionSystem.update();
+
+    ASSERT_FALSE(canMoveRight(componentOwnerWithPlayerCollider1) &&
+                 canMoveDown(componentOwnerWithPlayerCollider1));
+    ASSERT_TRUE(canMoveLeft(componentOwnerWithPlayerCollider1) &&
+                canMoveUp(componentOwnerWithPlayerCollider1));
+}
+
+TEST_F(DefaultCollisionSystemTest, resolvingWithSweptPairs_shouldBlockSameMovementsAsResolvingWithAreaQueries)
+{
+    // colliders remember their contacts, so every collision system resolves its own owners
+    const auto createOwners = [this](const std::string& name)
+    {
+        std::vector<std::shared_ptr<ComponentOwner>> componentOwners;
+        for (int ownerIndex = 0; ownerIndex < 200; ownerIndex++)
+        {
+            const auto column = static_cast<float>(ownerIndex % 20);
+            const auto row = static_cast<float>(ownerIndex / 20);
+            const utils::Vector2f position{column * 4.f + static_cast<float>(ownerIndex % 3), row * 6.f};
+            componentOwners.push_back(
+                createOwnerWithDefaultCollider(position, name + std::to_string(ownerIndex)));
+        }
+        return componentOwners;
+    };
+    auto ownersResolvedWithAreaQueries = createOwners("collisionSystemAreaQueriesTest");
+    auto ownersResolvedWithSweptPairs = createOwners("collisionSystemSweptPairsTest");
+    DefaultCollisionSystem gridCollisionSystem{
+        std::make_shared<StaticGridQuadtree>(std::make_unique<SpatialHashGrid>(bounds), bounds)};
+    DefaultCollisionSystem sweptCollisionSystem{
+        std::make_shared<StaticGridQuadtree>(std::make_unique<SweepAndPrune>(bounds), bounds)};
+    gridCollisionSystem.add(ownersResolvedWithAreaQueries);
+    sweptCollisionSystem.add(ownersResolvedWithSweptPairs);
+
+    gridCollisionSystem.update();
+    sweptCollisionSystem.update();
+
+    const auto movementsAllowedWithAreaQueries = getAllowedMovements(ownersResolvedWithAreaQueries);
+    ASSERT_NE(std::ranges::count(movementsAllowedWithAreaQueries, false), 0);
+    ASSERT_EQ(getAllowedMovements(ownersResolvedWithSweptPairs), movementsAllowedWithAreaQueries);
+}
\ No newline at end of file
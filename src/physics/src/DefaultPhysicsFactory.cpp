@@ -1,23 +1,50 @@
 #include "DefaultPhysicsFactory.h"
 
 #include "DefaultCollisionSystem.h"
+#include "DefaultQuadtree.h"
+#include "SpatialHashGrid.h"
+#include "StaticGridQuadtree.h"
+#include "SweepAndPrune.h"
 
 namespace physics
 {
+namespace
+{
+std::unique_ptr<Quadtree> createDynamicBroadphase(const utils::FloatRect& mapBoundaries,
+                                                  const BroadphaseSettings& broadphaseSettings)
+{
+    switch (broadphaseSettings.type)
+    {
+    case BroadphaseType::SpatialHashGrid:
+        return std::make_unique<SpatialHashGrid>(mapBoundaries, broadphaseSettings.cellSize);
+    case BroadphaseType::SweepAndPrune:
+        return std::make_unique<SweepAndPrune>(mapBoundaries);
+    case BroadphaseType::Quadtree:
+        break;
+    }
+
+    return std::make_unique<DefaultQuadtree>(mapBoundaries);
+}
+}
 
-DefaultPhysicsFactory::DefaultPhysicsFactory(const utils::FloatRect& mapBoundaries)
-    : quadtree{std::make_shared<DefaultQuadtree>(mapBoundaries)}
+DefaultPhysicsFactory::DefaultPhysicsFactory(const utils::FloatRect& mapBoundaries,
+                                             const BroadphaseSettings& broadphaseSettings,
+                                             const CollisionSystemSettings& collisionSystemSettingsInit)
+    : quadtree{std::make_shared<StaticGridQuadtree>(
+          createDynamicBroadphase(mapBoundaries, broadphaseSettings), mapBoundaries)},
+      rayCastCellSize{broadphaseSettings.cellSize},
+      collisionSystemSettings{collisionSystemSettingsInit}
 {
 }
 
 std::unique_ptr<CollisionSystem> DefaultPhysicsFactory::createCollisionSystem() const
 {
-    return std::make_unique<DefaultCollisionSystem>(quadtree);
+    return std::make_unique<DefaultCollisionSystem>(quadtree, collisionSystemSettings);
 }
 
 std::shared_ptr<RayCast> DefaultPhysicsFactory::createRayCast() const
 {
-    return std::make_shared<DefaultRayCast>(quadtree);
+    return std::make_shared<DefaultRayCast>(quadtree, rayCastCellSize);
 }
 
 std::shared_ptr<Quadtree> DefaultPhysicsFactory::getQuadTree() const
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "DefaultQuadtree.h"
 #include "DefaultRayCast.h"
 #include "PhysicsFactory.h"
 
@@ -9,13 +8,16 @@ namespace physics
 class DefaultPhysicsFactory : public PhysicsFactory
 {
 public:
-    DefaultPhysicsFactory(const utils::FloatRect& mapBoundaries);
+    DefaultPhysicsFactory(const utils::FloatRect& mapBoundaries, const BroadphaseSettings& = {},
+                          const CollisionSystemSettings& = {});
 
     std::unique_ptr<CollisionSystem> createCollisionSystem() const override;
     std::shared_ptr<RayCast> createRayCast() const override;
     std::shared_ptr<Quadtree> getQuadTree() const override;
 
 private:
-    std::shared_ptr<DefaultQuadtree> quadtree;
+    std::shared_ptr<Quadtree> quadtree;
+    float rayCastCellSize;
+    CollisionSystemSettings collisionSystemSettings;
 };
 }
@@ -1,18 +1,11 @@
 #include "DefaultQuadtree.h"
 
-#include <cmath>
+#include <algorithm>
+
+#include "RectDistance.h"
 
 namespace physics
 {
-namespace
-{
-double calculateDistanceBetweenRects(const utils::FloatRect& lhs, const utils::FloatRect& rhs)
-{
-    constexpr auto square = [](const double number) { return number * number; };
-    return std::sqrt(square((lhs.top + lhs.height / 2) - (rhs.top + rhs.height / 2)) +
-                     square((lhs.left + lhs.width / 2) - (rhs.left + rhs.width / 2)));
-}
-}
 
 DefaultQuadtree::DefaultQuadtree() : DefaultQuadtree{5, 5, 0, {0, 0, 160, 60}} {}
 
@@ -20,110 +13,121 @@ DefaultQuadtree::DefaultQuadtree(const utils::FloatRect& bounds) : DefaultQuadtr
 
 DefaultQuadtree::DefaultQuadtree(int maxObjectsInNodeBeforeSplitInit, int maxNumberOfSplitsInit,
                                  int treeDepthLevelInit, utils::FloatRect boundsInit)
-    : children{nullptr, nullptr, nullptr, nullptr},
-      nodeBounds{boundsInit},
+    : nodes{{boundsInit, treeDepthLevelInit, emptyIndex, emptyIndex, emptyIndex, emptyIndex, 0}},
       maxObjectsInNodeBeforeSplit{maxObjectsInNodeBeforeSplitInit},
-      maxNumberOfSplits{maxNumberOfSplitsInit},
-      currentTreeDepthLevel{treeDepthLevelInit}
+      maxNumberOfSplits{maxNumberOfSplitsInit}
 {
 }
 
 void DefaultQuadtree::insertCollider(
     const std::shared_ptr<components::core::BoxColliderComponent>& colliderToInsert)
 {
-    if (children[0])
+    if (indicesOfColliders.contains(colliderToInsert.get()))
     {
-        const int indexToPlaceObject =
-            getIndexIndicatingToWhichNodeColliderBelongs(colliderToInsert->getCollisionBox());
+        updateCollider(colliderToInsert);
+        return;
+    }
 
-        if (indexToPlaceObject != thisTreeIndex)
-        {
-            children[indexToPlaceObject]->insertCollider(colliderToInsert);
-        }
-        else
-        {
-            colliders.emplace_back(colliderToInsert);
-        }
+    const auto layerMask = components::core::toCollisionLayerMask(colliderToInsert->getCollisionLayer());
+    int colliderIndex;
+
+    if (freeColliderIndices.empty())
+    {
+        colliderIndex = static_cast<int>(colliders.size());
+        colliders.push_back({colliderToInsert, layerMask, emptyIndex, emptyIndex, emptyIndex});
+    }
+    else
+    {
+        colliderIndex = freeColliderIndices.back();
+        freeColliderIndices.pop_back();
+        colliders[colliderIndex] = {colliderToInsert, layerMask, emptyIndex, emptyIndex, emptyIndex};
+    }
+
+    indicesOfColliders[colliderToInsert.get()] = colliderIndex;
+    insertColliderIntoNode(findNodeForBounds(colliderToInsert->getCollisionBox()), colliderIndex);
+}
+
+void DefaultQuadtree::updateCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToUpdate)
+{
+    const auto colliderIndex = indicesOfColliders.find(colliderToUpdate.get());
+
+    if (colliderIndex == indicesOfColliders.end())
+    {
+        insertCollider(colliderToUpdate);
         return;
     }
 
-    colliders.emplace_back(colliderToInsert);
+    colliders[colliderIndex->second].layerMask =
+        components::core::toCollisionLayerMask(colliderToUpdate->getCollisionLayer());
+    const auto currentNodeIndex = colliders[colliderIndex->second].nodeIndex;
 
-    if (static_cast<int>(colliders.size()) > maxObjectsInNodeBeforeSplit &&
-        currentTreeDepthLevel < maxNumberOfSplits)
+    if (findNodeForBounds(colliderToUpdate->getCollisionBox()) == currentNodeIndex)
     {
-        splitIntoChildNodes();
-        for (auto& collider : colliders)
-        {
-            if (const int indexToPlaceObject =
-                    getIndexIndicatingToWhichNodeColliderBelongs(collider->getCollisionBox());
-                indexToPlaceObject != thisTreeIndex)
-            {
-                children[indexToPlaceObject]->insertCollider(collider);
-            }
-        }
+        return;
+    }
 
-        colliders.erase(std::remove_if(colliders.begin(), colliders.end(),
-                                       [&](auto& collider) {
-                                           return getIndexIndicatingToWhichNodeColliderBelongs(
-                                                      collider->getCollisionBox()) != thisTreeIndex;
-                                       }),
-                        colliders.end());
+    unlinkColliderFromNode(colliderIndex->second);
+
+    if (const auto parentIndex = nodes[currentNodeIndex].parentIndex; parentIndex != emptyIndex)
+    {
+        mergeEmptyChildNodes(parentIndex);
     }
+
+    insertColliderIntoNode(findNodeForBounds(colliderToUpdate->getCollisionBox()), colliderIndex->second);
 }
 
 void DefaultQuadtree::removeCollider(
     const std::shared_ptr<components::core::BoxColliderComponent>& colliderToRemove)
 {
-    const int index = getIndexIndicatingToWhichNodeColliderBelongs(colliderToRemove->getCollisionBox());
+    const auto colliderIndex = indicesOfColliders.find(colliderToRemove.get());
 
-    if (index != thisTreeIndex && children[index])
+    if (colliderIndex == indicesOfColliders.end())
     {
-        children[index]->removeCollider(colliderToRemove);
         return;
     }
 
-    colliders.erase(std::remove_if(colliders.begin(), colliders.end(),
-                                   [&](auto& collider)
-                                   { return collider->getOwnerId() == colliderToRemove->getOwnerId(); }),
-                    colliders.end());
+    const auto currentNodeIndex = colliders[colliderIndex->second].nodeIndex;
+    unlinkColliderFromNode(colliderIndex->second);
+    colliders[colliderIndex->second].collider = nullptr;
+    freeColliderIndices.push_back(colliderIndex->second);
+    indicesOfColliders.erase(colliderIndex);
+
+    if (const auto parentIndex = nodes[currentNodeIndex].parentIndex; parentIndex != emptyIndex)
+    {
+        mergeEmptyChildNodes(parentIndex);
+    }
 }
 
 void DefaultQuadtree::clearAllColliders()
 {
+    auto& root = nodes[rootIndex];
+    root.firstChildIndex = emptyIndex;
+    root.firstColliderIndex = emptyIndex;
+    root.lastColliderIndex = emptyIndex;
+    root.numberOfColliders = 0;
+
+    nodes.erase(nodes.begin() + 1, nodes.end());
+    freeChildNodesIndices.clear();
     colliders.clear();
-
-    if (children[0])
-    {
-        for (auto& child : children)
-        {
-            child->clearAllColliders();
-            child = nullptr;
-        }
-    }
+    freeColliderIndices.clear();
+    indicesOfColliders.clear();
 }
 
 std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
 DefaultQuadtree::getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const
 {
-    const auto possibleColliders = getAllCollidersFromQuadtreeNodesIntersectingWithArea(area);
-
     std::vector<std::shared_ptr<components::core::BoxColliderComponent>> collidersIntersectingWithArea;
 
-    for (const auto& possibleCollider : possibleColliders)
-    {
-        auto& possibleColliderBox = possibleCollider->getNextFrameXCollisionBox();
-
-        if (area.intersects(possibleColliderBox))
+    visitCollidersFromQuadtreeNodesIntersectingWithArea(
+        rootIndex, area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
         {
-            if (const auto distance = calculateDistanceBetweenRects(area, possibleColliderBox);
-                distance != 0.0)
+            if (intersectsWithArea(area, possibleCollider->getNextFrameXCollisionBox()))
             {
-                collidersIntersectingWithArea.emplace_back(
-                    std::shared_ptr<components::core::BoxColliderComponent>(possibleCollider));
+                collidersIntersectingWithArea.push_back(possibleCollider);
             }
-        }
-    }
+        });
 
     return collidersIntersectingWithArea;
 }
@@ -131,73 +135,148 @@ DefaultQuadtree::getCollidersIntersectingWithAreaFromX(const utils::FloatRect& a
 std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
 DefaultQuadtree::getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const
 {
-    const auto possibleColliders = getAllCollidersFromQuadtreeNodesIntersectingWithArea(area);
-
     std::vector<std::shared_ptr<components::core::BoxColliderComponent>> collidersIntersectingWithArea;
 
-    for (const auto& possibleCollider : possibleColliders)
-    {
-        auto& possibleColliderBox = possibleCollider->getNextFrameYCollisionBox();
-
-        if (area.intersects(possibleColliderBox))
+    visitCollidersFromQuadtreeNodesIntersectingWithArea(
+        rootIndex, area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
         {
-            if (const auto distance = calculateDistanceBetweenRects(area, possibleColliderBox);
-                distance != 0.0)
+            if (intersectsWithArea(area, possibleCollider->getNextFrameYCollisionBox()))
             {
-                collidersIntersectingWithArea.emplace_back(
-                    std::shared_ptr<components::core::BoxColliderComponent>(possibleCollider));
+                collidersIntersectingWithArea.push_back(possibleCollider);
             }
-        }
-    }
+        });
 
     return collidersIntersectingWithArea;
 }
 
+void DefaultQuadtree::getCollidersIntersectingWithAreaFromX(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    visitCollidersFromQuadtreeNodesIntersectingWithArea(
+        rootIndex, area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameXCollisionBox()))
+            {
+                colliders.push_back(possibleCollider.get());
+            }
+        });
+}
+
+void DefaultQuadtree::getCollidersIntersectingWithAreaFromY(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    visitCollidersFromQuadtreeNodesIntersectingWithArea(
+        rootIndex, area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameYCollisionBox()))
+            {
+                colliders.push_back(possibleCollider.get());
+            }
+        });
+}
+
+void DefaultQuadtree::getPossibleCollidersInArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+    components::core::CollisionLayerMask layerMask) const
+{
+    visitCollidersFromQuadtreeNodesIntersectingWithArea(
+        rootIndex, area, layerMask,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        { colliders.push_back(possibleCollider.get()); });
+}
+
+bool DefaultQuadtree::getPossibleCollisionPairs(std::vector<CollisionPair>&) const
+{
+    return false;
+}
+
+void DefaultQuadtree::getPossibleStaticCollidersInArea(
+    const utils::FloatRect&, std::vector<components::core::BoxColliderComponent*>&) const
+{
+}
+
 const utils::FloatRect& DefaultQuadtree::getNodeBounds() const
 {
-    return nodeBounds;
+    return nodes[rootIndex].bounds;
 }
 
-std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
-DefaultQuadtree::getAllCollidersFromQuadtreeNodesIntersectingWithArea(const sf::FloatRect& area) const
+QuadtreeStatistics DefaultQuadtree::getStatistics() const
 {
-    auto possibleColliders = colliders;
+    QuadtreeStatistics statistics{};
+    collectStatistics(rootIndex, statistics);
+    statistics.depth -= nodes[rootIndex].treeDepthLevel;
+    return statistics;
+}
+
+template <typename Visitor>
+void DefaultQuadtree::visitCollidersFromQuadtreeNodesIntersectingWithArea(
+    int nodeIndex, const sf::FloatRect& area, components::core::CollisionLayerMask layerMask,
+    Visitor&& visitor) const
+{
+    const auto& node = nodes[nodeIndex];
+
+    for (auto colliderIndex = node.firstColliderIndex; colliderIndex != emptyIndex;
+         colliderIndex = colliders[colliderIndex].nextColliderIndex)
+    {
+        const auto& colliderInNode = colliders[colliderIndex];
+
+        if ((colliderInNode.layerMask & layerMask) and colliderInNode.collider->isEnabled())
+        {
+            visitor(colliderInNode.collider);
+        }
+    }
 
-    if (children[0])
+    if (node.firstChildIndex == emptyIndex)
     {
-        if (int index = getIndexIndicatingToWhichNodeColliderBelongs(area); index == thisTreeIndex)
+        return;
+    }
+
+    if (int index = getIndexIndicatingToWhichNodeColliderBelongs(node.bounds, area); index == thisTreeIndex)
+    {
+        for (int childIndex = node.firstChildIndex; childIndex < node.firstChildIndex + 4; childIndex++)
         {
-            for (const auto& child : children)
+            if (nodes[childIndex].bounds.intersects(area))
             {
-                if (child->getNodeBounds().intersects(area))
-                {
-                    const auto possibleCollidersFromChild =
-                        child->getAllCollidersFromQuadtreeNodesIntersectingWithArea(area);
-                    possibleColliders.insert(possibleColliders.end(), possibleCollidersFromChild.begin(),
-                                             possibleCollidersFromChild.end());
-                }
+                visitCollidersFromQuadtreeNodesIntersectingWithArea(childIndex, area, layerMask, visitor);
             }
         }
-        else
-        {
-            const auto possibleCollidersFromChild =
-                children[index]->getAllCollidersFromQuadtreeNodesIntersectingWithArea(area);
+    }
+    else
+    {
+        visitCollidersFromQuadtreeNodesIntersectingWithArea(node.firstChildIndex + index, area, layerMask,
+                                                            visitor);
+    }
+}
 
-            possibleColliders.insert(possibleColliders.end(), possibleCollidersFromChild.begin(),
-                                     possibleCollidersFromChild.end());
-        }
+void DefaultQuadtree::collectStatistics(int nodeIndex, QuadtreeStatistics& statistics) const
+{
+    const auto& node = nodes[nodeIndex];
+
+    statistics.depth = std::max(statistics.depth, node.treeDepthLevel + 1);
+    statistics.numberOfNodes++;
+    statistics.numberOfColliders += node.numberOfColliders;
+    statistics.maxNumberOfCollidersInNode =
+        std::max(statistics.maxNumberOfCollidersInNode, node.numberOfColliders);
+
+    if (isLeaf(nodeIndex))
+    {
+        statistics.numberOfLeafNodes++;
+        return;
     }
 
-    possibleColliders.erase(
-        std::remove_if(possibleColliders.begin(), possibleColliders.end(),
-                       [](const std::shared_ptr<components::core::BoxColliderComponent>& collider)
-                       { return !collider->isEnabled(); }),
-        possibleColliders.end());
+    statistics.numberOfCollidersInInnerNodes += node.numberOfColliders;
 
-    return possibleColliders;
+    for (int childIndex = node.firstChildIndex; childIndex < node.firstChildIndex + 4; childIndex++)
+    {
+        collectStatistics(childIndex, statistics);
+    }
 }
 
-int DefaultQuadtree::getIndexIndicatingToWhichNodeColliderBelongs(const sf::FloatRect& objectBounds) const
+int DefaultQuadtree::getIndexIndicatingToWhichNodeColliderBelongs(const sf::FloatRect& nodeBounds,
+                                                                  const sf::FloatRect& objectBounds)
 {
     const double verticalDividingLine = nodeBounds.left + nodeBounds.width * 0.5f;
     const double horizontalDividingLine = nodeBounds.top + nodeBounds.height * 0.5f;
@@ -235,23 +314,174 @@ int DefaultQuadtree::getIndexIndicatingToWhichNodeColliderBelongs(const sf::Floa
     return thisTreeIndex;
 }
 
-void DefaultQuadtree::splitIntoChildNodes()
+void DefaultQuadtree::insertColliderIntoNode(int nodeIndex, int colliderIndex)
+{
+    linkColliderToNode(nodeIndex, colliderIndex);
+
+    if (not isLeaf(nodeIndex) or nodes[nodeIndex].numberOfColliders <= maxObjectsInNodeBeforeSplit or
+        nodes[nodeIndex].treeDepthLevel >= maxNumberOfSplits)
+    {
+        return;
+    }
+
+    splitIntoChildNodes(nodeIndex);
+
+    auto colliderToMoveIndex = nodes[nodeIndex].firstColliderIndex;
+
+    while (colliderToMoveIndex != emptyIndex)
+    {
+        const auto nextColliderIndex = colliders[colliderToMoveIndex].nextColliderIndex;
+
+        if (const int indexToPlaceObject = getIndexIndicatingToWhichNodeColliderBelongs(
+                nodes[nodeIndex].bounds, colliders[colliderToMoveIndex].collider->getCollisionBox());
+            indexToPlaceObject != thisTreeIndex)
+        {
+            unlinkColliderFromNode(colliderToMoveIndex);
+            insertColliderIntoNode(nodes[nodeIndex].firstChildIndex + indexToPlaceObject,
+                                   colliderToMoveIndex);
+        }
+
+        colliderToMoveIndex = nextColliderIndex;
+    }
+}
+
+void DefaultQuadtree::linkColliderToNode(int nodeIndex, int colliderIndex)
+{
+    auto& node = nodes[nodeIndex];
+    auto& colliderInNode = colliders[colliderIndex];
+
+    colliderInNode.nodeIndex = nodeIndex;
+    colliderInNode.previousColliderIndex = node.lastColliderIndex;
+    colliderInNode.nextColliderIndex = emptyIndex;
+
+    if (node.lastColliderIndex == emptyIndex)
+    {
+        node.firstColliderIndex = colliderIndex;
+    }
+    else
+    {
+        colliders[node.lastColliderIndex].nextColliderIndex = colliderIndex;
+    }
+
+    node.lastColliderIndex = colliderIndex;
+    node.numberOfColliders++;
+}
+
+void DefaultQuadtree::unlinkColliderFromNode(int colliderIndex)
 {
+    auto& colliderInNode = colliders[colliderIndex];
+    auto& node = nodes[colliderInNode.nodeIndex];
+
+    if (colliderInNode.previousColliderIndex == emptyIndex)
+    {
+        node.firstColliderIndex = colliderInNode.nextColliderIndex;
+    }
+    else
+    {
+        colliders[colliderInNode.previousColliderIndex].nextColliderIndex = colliderInNode.nextColliderIndex;
+    }
+
+    if (colliderInNode.nextColliderIndex == emptyIndex)
+    {
+        node.lastColliderIndex = colliderInNode.previousColliderIndex;
+    }
+    else
+    {
+        colliders[colliderInNode.nextColliderIndex].previousColliderIndex =
+            colliderInNode.previousColliderIndex;
+    }
+
+    node.numberOfColliders--;
+    colliderInNode.nodeIndex = emptyIndex;
+    colliderInNode.previousColliderIndex = emptyIndex;
+    colliderInNode.nextColliderIndex = emptyIndex;
+}
+
+void DefaultQuadtree::mergeEmptyChildNodes(int nodeIndex)
+{
+    if (isLeaf(nodeIndex))
+    {
+        return;
+    }
+
+    const auto firstChildIndex = nodes[nodeIndex].firstChildIndex;
+
+    for (int childIndex = firstChildIndex; childIndex < firstChildIndex + 4; childIndex++)
+    {
+        if (not isLeaf(childIndex) or nodes[childIndex].numberOfColliders != 0)
+        {
+            return;
+        }
+    }
+
+    freeChildNodesIndices.push_back(firstChildIndex);
+    nodes[nodeIndex].firstChildIndex = emptyIndex;
+
+    if (const auto parentIndex = nodes[nodeIndex].parentIndex; parentIndex != emptyIndex)
+    {
+        mergeEmptyChildNodes(parentIndex);
+    }
+}
+
+void DefaultQuadtree::splitIntoChildNodes(int nodeIndex)
+{
+    int firstChildIndex;
+
+    if (freeChildNodesIndices.empty())
+    {
+        firstChildIndex = static_cast<int>(nodes.size());
+        nodes.resize(nodes.size() + 4);
+    }
+    else
+    {
+        firstChildIndex = freeChildNodesIndices.back();
+        freeChildNodesIndices.pop_back();
+    }
+
+    const auto nodeBounds = nodes[nodeIndex].bounds;
+    const auto childTreeDepthLevel = nodes[nodeIndex].treeDepthLevel + 1;
     const float childWidth = nodeBounds.width / 2.f;
     const float childHeight = nodeBounds.height / 2.f;
 
-    children[childNorthEastIndex] = std::make_shared<DefaultQuadtree>(
-        maxObjectsInNodeBeforeSplit, maxNumberOfSplits, currentTreeDepthLevel + 1,
-        sf::FloatRect(nodeBounds.left + childWidth, nodeBounds.top, childWidth, childHeight));
-    children[childNorthWestIndex] = std::make_shared<DefaultQuadtree>(
-        maxObjectsInNodeBeforeSplit, maxNumberOfSplits, currentTreeDepthLevel + 1,
-        sf::FloatRect(nodeBounds.left, nodeBounds.top, childWidth, childHeight));
-    children[childSouthWestIndex] = std::make_shared<DefaultQuadtree>(
-        maxObjectsInNodeBeforeSplit, maxNumberOfSplits, currentTreeDepthLevel + 1,
+    const auto createChildNode = [&](const sf::FloatRect& childBounds)
+    {
+        return Node{childBounds, childTreeDepthLevel, nodeIndex, emptyIndex, emptyIndex, emptyIndex, 0};
+    };
+
+    nodes[firstChildIndex + childNorthEastIndex] =
+        createChildNode(sf::FloatRect(nodeBounds.left + childWidth, nodeBounds.top, childWidth, childHeight));
+    nodes[firstChildIndex + childNorthWestIndex] =
+        createChildNode(sf::FloatRect(nodeBounds.left, nodeBounds.top, childWidth, childHeight));
+    nodes[firstChildIndex + childSouthWestIndex] = createChildNode(
         sf::FloatRect(nodeBounds.left, nodeBounds.top + childHeight, childWidth, childHeight));
-    children[childSouthEastIndex] = std::make_shared<DefaultQuadtree>(
-        maxObjectsInNodeBeforeSplit, maxNumberOfSplits, currentTreeDepthLevel + 1,
+    nodes[firstChildIndex + childSouthEastIndex] = createChildNode(
         sf::FloatRect(nodeBounds.left + childWidth, nodeBounds.top + childHeight, childWidth, childHeight));
+
+    nodes[nodeIndex].firstChildIndex = firstChildIndex;
+}
+
+bool DefaultQuadtree::isLeaf(int nodeIndex) const
+{
+    return nodes[nodeIndex].firstChildIndex == emptyIndex;
+}
+
+int DefaultQuadtree::findNodeForBounds(const sf::FloatRect& objectBounds) const
+{
+    auto nodeIndex = rootIndex;
+
+    while (not isLeaf(nodeIndex))
+    {
+        const int index = getIndexIndicatingToWhichNodeColliderBelongs(nodes[nodeIndex].bounds, objectBounds);
+
+        if (index == thisTreeIndex)
+        {
+            break;
+        }
+
+        nodeIndex = nodes[nodeIndex].firstChildIndex + index;
+    }
+
+    return nodeIndex;
 }
 
 }
\ No newline at end of file
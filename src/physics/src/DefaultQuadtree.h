@@ -1,8 +1,10 @@
 #pragma once
 
-#include <array>
+#include <unordered_map>
+#include <vector>
 
 #include "Quadtree.h"
+#include "QuadtreeStatistics.h"
 
 namespace physics
 {
@@ -15,6 +17,7 @@ public:
                     utils::FloatRect bounds);
 
     void insertCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void updateCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
     void removeCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
     void clearAllColliders() override;
     const utils::FloatRect& getNodeBounds() const override;
@@ -22,24 +25,72 @@ public:
     getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const override;
     std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
     getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const override;
+    void getCollidersIntersectingWithAreaFromX(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getCollidersIntersectingWithAreaFromY(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getPossibleCollidersInArea(
+        const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+        components::core::CollisionLayerMask layerMask = components::core::allCollisionLayers) const override;
+    bool getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const override;
+    void getPossibleStaticCollidersInArea(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    QuadtreeStatistics getStatistics() const;
 
 private:
-    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
-    getAllCollidersFromQuadtreeNodesIntersectingWithArea(const sf::FloatRect& area) const;
-    int getIndexIndicatingToWhichNodeColliderBelongs(const sf::FloatRect& objectBounds) const;
-    void splitIntoChildNodes();
+    // children of a node are stored as four consecutive nodes starting from firstChildIndex
+    struct Node
+    {
+        utils::FloatRect bounds;
+        int treeDepthLevel;
+        int parentIndex;
+        int firstChildIndex;
+        int firstColliderIndex;
+        int lastColliderIndex;
+        int numberOfColliders;
+    };
+
+    struct ColliderInNode
+    {
+        std::shared_ptr<components::core::BoxColliderComponent> collider;
+        components::core::CollisionLayerMask layerMask;
+        int nodeIndex;
+        int previousColliderIndex;
+        int nextColliderIndex;
+    };
+
+    void insertColliderIntoNode(int nodeIndex, int colliderIndex);
+    void linkColliderToNode(int nodeIndex, int colliderIndex);
+    void unlinkColliderFromNode(int colliderIndex);
+    void mergeEmptyChildNodes(int nodeIndex);
+    void splitIntoChildNodes(int nodeIndex);
+    bool isLeaf(int nodeIndex) const;
+    int findNodeForBounds(const sf::FloatRect& objectBounds) const;
+    template <typename Visitor>
+    void visitCollidersFromQuadtreeNodesIntersectingWithArea(int nodeIndex, const sf::FloatRect& area,
+                                                             components::core::CollisionLayerMask,
+                                                             Visitor&& visitor) const;
+    void collectStatistics(int nodeIndex, QuadtreeStatistics&) const;
+    static int getIndexIndicatingToWhichNodeColliderBelongs(const sf::FloatRect& nodeBounds,
+                                                            const sf::FloatRect& objectBounds);
 
-    std::array<std::shared_ptr<DefaultQuadtree>, 4> children;
-    std::vector<std::shared_ptr<components::core::BoxColliderComponent>> colliders;
-    utils::FloatRect nodeBounds;
+    std::vector<Node> nodes;
+    std::vector<int> freeChildNodesIndices;
+    std::vector<ColliderInNode> colliders;
+    std::vector<int> freeColliderIndices;
+    std::unordered_map<const components::core::BoxColliderComponent*, int> indicesOfColliders;
     const int maxObjectsInNodeBeforeSplit;
     const int maxNumberOfSplits;
-    int currentTreeDepthLevel;
 
+    static constexpr int rootIndex = 0;
+    static constexpr int emptyIndex = -1;
     static const int thisTreeIndex = -1;
     static const int childNorthEastIndex = 0;
     static const int childNorthWestIndex = 1;
     static const int childSouthWestIndex = 2;
     static const int childSouthEastIndex = 3;
 };
-}
\ No newline at end of file
+}
@@ -250,4 +250,220 @@ TEST_F(DefaultQuadtreeTest,
 
         ASSERT_GE(collidersIntersectingWithArea.size(), 1);
     }
-}
\ No newline at end of file
+}
+TEST_F(DefaultQuadtreeTest, updatedColliderThatMoved_canBeIntersectedOnlyWithAreaAtNewPosition)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent3);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponent9);
+
+    componentOwner1.transform->setPosition(position3);
+    quadtree.updateCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithOldArea = quadtree.getCollidersIntersectingWithAreaFromX(area1);
+    const auto collidersIntersectingWithNewArea = quadtree.getCollidersIntersectingWithAreaFromX(area2);
+    ASSERT_TRUE(collidersIntersectingWithOldArea.empty());
+    ASSERT_TRUE(std::find(collidersIntersectingWithNewArea.begin(), collidersIntersectingWithNewArea.end(),
+                          boxColliderComponent1) != collidersIntersectingWithNewArea.end());
+}
+
+TEST_F(DefaultQuadtreeTest, updatedColliderNotInsertedBefore_canBeIntersectedWithArea)
+{
+    DefaultQuadtree quadtree{};
+    quadtree.updateCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithArea = quadtree.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_EQ(collidersIntersectingWithArea.size(), 1u);
+}
+
+TEST_F(DefaultQuadtreeTest, colliderInsertedTwice_shouldBeReturnedOnce)
+{
+    DefaultQuadtree quadtree{};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithArea = quadtree.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_EQ(collidersIntersectingWithArea.size(), 1u);
+}
+
+TEST_F(DefaultQuadtreeTest, removedColliderThatMovedWithoutUpdate_canNotBeIntersectedWithArea)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent2);
+    quadtree.insertCollider(boxColliderComponent3);
+    quadtree.insertCollider(boxColliderComponent9);
+
+    componentOwner1.transform->setPosition(position9);
+    quadtree.removeCollider(boxColliderComponent1);
+
+    componentOwner1.transform->setPosition(position1);
+    const auto collidersIntersectingWithArea = quadtree.getCollidersIntersectingWithAreaFromX(area1);
+    ASSERT_TRUE(std::find(collidersIntersectingWithArea.begin(), collidersIntersectingWithArea.end(),
+                          boxColliderComponent1) == collidersIntersectingWithArea.end());
+}
+
+TEST_F(DefaultQuadtreeTest, allCollidersRemovedFromSplitTree_shouldReturnEmptyColliders)
+{
+    const auto boxColliders = {boxColliderComponent1, boxColliderComponent2, boxColliderComponent3,
+                               boxColliderComponent4, boxColliderComponent5, boxColliderComponent6};
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    for (const auto& boxCollider : boxColliders)
+    {
+        quadtree.insertCollider(boxCollider);
+    }
+
+    for (const auto& boxCollider : boxColliders)
+    {
+        quadtree.removeCollider(boxCollider);
+    }
+
+    quadtree.insertCollider(boxColliderComponent3);
+    const auto collidersIntersectingWithArea = quadtree.getCollidersIntersectingWithAreaFromX(area2);
+    ASSERT_EQ(collidersIntersectingWithArea.size(), 1u);
+}
+
+TEST_F(DefaultQuadtreeTest, collidersIntersectingWithAreaFromSplitTree_shouldBeAppendedToBuffer)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent2);
+    quadtree.insertCollider(boxColliderComponent3);
+    quadtree.insertCollider(boxColliderComponent9);
+    std::vector<BoxColliderComponent*> collidersIntersectingWithArea;
+
+    quadtree.getCollidersIntersectingWithAreaFromX(area1, collidersIntersectingWithArea);
+    quadtree.getCollidersIntersectingWithAreaFromY(area2, collidersIntersectingWithArea);
+
+    const auto expectedCollidersFromX = quadtree.getCollidersIntersectingWithAreaFromX(area1);
+    const auto expectedCollidersFromY = quadtree.getCollidersIntersectingWithAreaFromY(area2);
+    ASSERT_EQ(collidersIntersectingWithArea.size(),
+              expectedCollidersFromX.size() + expectedCollidersFromY.size());
+    ASSERT_TRUE(std::find(collidersIntersectingWithArea.begin(), collidersIntersectingWithArea.end(),
+                          boxColliderComponent3.get()) != collidersIntersectingWithArea.end());
+}
+
+TEST_F(DefaultQuadtreeTest, disabledCollider_shouldNotBeAppendedToBuffer)
+{
+    DefaultQuadtree quadtree{};
+    quadtree.insertCollider(boxColliderComponent1);
+    boxColliderComponent1->disable();
+    std::vector<BoxColliderComponent*> collidersIntersectingWithArea;
+
+    quadtree.getCollidersIntersectingWithAreaFromX(area1, collidersIntersectingWithArea);
+
+    ASSERT_TRUE(collidersIntersectingWithArea.empty());
+}
+
+TEST_F(DefaultQuadtreeTest, givenNoColliders_statisticsShouldDescribeOnlyRootNode)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+
+    const auto statistics = quadtree.getStatistics();
+
+    ASSERT_EQ(statistics.depth, 1);
+    ASSERT_EQ(statistics.numberOfNodes, 1);
+    ASSERT_EQ(statistics.numberOfLeafNodes, 1);
+    ASSERT_EQ(statistics.numberOfColliders, 0);
+}
+
+TEST_F(DefaultQuadtreeTest, givenSplitTree_statisticsShouldDescribeChildNodesAndOccupancy)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponentOnNorthEdge);
+
+    const auto statistics = quadtree.getStatistics();
+
+    ASSERT_EQ(statistics.depth, 2);
+    ASSERT_EQ(statistics.numberOfNodes, 5);
+    ASSERT_EQ(statistics.numberOfLeafNodes, 4);
+    ASSERT_EQ(statistics.numberOfColliders, 3);
+    ASSERT_EQ(statistics.numberOfCollidersInInnerNodes, 1);
+    ASSERT_EQ(statistics.maxNumberOfCollidersInNode, 1);
+}
+
+TEST_F(DefaultQuadtreeTest, allCollidersRemovedFromSplitTree_shouldMergeChildNodesBackIntoRoot)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponent9);
+
+    quadtree.removeCollider(boxColliderComponent1);
+    quadtree.removeCollider(boxColliderComponent8);
+    quadtree.removeCollider(boxColliderComponent9);
+
+    const auto statistics = quadtree.getStatistics();
+    ASSERT_EQ(statistics.numberOfNodes, 1);
+    ASSERT_EQ(statistics.numberOfColliders, 0);
+}
+
+TEST_F(DefaultQuadtreeTest, clearedSplitTree_shouldBeSplitAgainAfterInsertions)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponent9);
+    quadtree.clearAllColliders();
+
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponent9);
+
+    ASSERT_EQ(quadtree.getStatistics().numberOfNodes, 5);
+    ASSERT_EQ(quadtree.getCollidersIntersectingWithAreaFromX(area1).size(), 1u);
+}
+
+TEST_F(DefaultQuadtreeTest, possibleCollidersInArea_shouldContainCollidersFromNodesIntersectingWithArea)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponentOnNorthEdge);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    quadtree.getPossibleCollidersInArea(area1, possibleColliders);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{boxColliderComponentOnNorthEdge.get(),
+                                                               boxColliderComponent1.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(DefaultQuadtreeTest, possibleCollidersInArea_shouldSkipCollidersFromLayersOutsideOfMask)
+{
+    DefaultQuadtree quadtree{2, 10, 1, utils::FloatRect(0, 0, 80, 60)};
+    boxColliderComponentOnNorthEdge->setCollisionLayer(CollisionLayer::Tile);
+    quadtree.insertCollider(boxColliderComponent1);
+    quadtree.insertCollider(boxColliderComponent8);
+    quadtree.insertCollider(boxColliderComponentOnNorthEdge);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    quadtree.getPossibleCollidersInArea(area1, possibleColliders,
+                                        toCollisionLayerMask(CollisionLayer::Default));
+
+    const std::vector<BoxColliderComponent*> expectedColliders{boxColliderComponent1.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(DefaultQuadtreeTest, updatedColliderWithChangedLayer_shouldBeFilteredByNewLayer)
+{
+    DefaultQuadtree quadtree{};
+    quadtree.insertCollider(boxColliderComponent1);
+    boxColliderComponent1->setCollisionLayer(CollisionLayer::Player);
+
+    quadtree.updateCollider(boxColliderComponent1);
+
+    std::vector<BoxColliderComponent*> defaultColliders;
+    quadtree.getPossibleCollidersInArea(area1, defaultColliders,
+                                        toCollisionLayerMask(CollisionLayer::Default));
+    std::vector<BoxColliderComponent*> playerColliders;
+    quadtree.getPossibleCollidersInArea(area1, playerColliders, toCollisionLayerMask(CollisionLayer::Player));
+    ASSERT_TRUE(defaultColliders.empty());
+    ASSERT_EQ(playerColliders.size(), 1u);
+}
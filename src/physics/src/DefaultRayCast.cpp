@@ -1,114 +1,290 @@
 #include "DefaultRayCast.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <thread>
+#include <utility>
 
 #include "BoxColliderComponent.h"
 
 namespace physics
 {
+namespace
+{
+const auto infinity = std::numeric_limits<float>::infinity();
+const std::size_t minimumNumberOfRaysPerThread{16};
 
-DefaultRayCast::DefaultRayCast(std::shared_ptr<Quadtree> quadtree) : collisions{std::move(quadtree)} {}
+std::size_t getNumberOfThreads(unsigned int numberOfThreads)
+{
+    return numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads;
+}
+}
+
+DefaultRayCast::DefaultRayCast(std::shared_ptr<Quadtree> quadtree, float cellSizeInit,
+                               unsigned int numberOfThreads)
+    : collisions{std::move(quadtree)},
+      cellSize{cellSizeInit},
+      snapshot{cellSizeInit},
+      workerPool{getNumberOfThreads(numberOfThreads)}
+{
+}
 
 RayCastResult DefaultRayCast::cast(const utils::Vector2f& from, const utils::Vector2f& to,
                                    unsigned int exclusionID, float lineWidth) const
 {
-    if (from == to)
+    const auto halfLineWidth = lineWidth / 2.f;
+    const auto direction = to - from;
+
+    return findNearestHit(
+        from, to,
+        [&](const utils::FloatRect& cell, float cellExitTime)
+        {
+            colliders.clear();
+            collisions->getPossibleCollidersInArea(widen(cell, halfLineWidth), colliders);
+
+            std::optional<Hit> nearestHit;
+
+            for (const auto collider : colliders)
+            {
+                if (exclusionID != collider->getOwnerId())
+                {
+                    updateNearestHit(nearestHit, &collider->getOwner(), collider->getCollisionBox(), from,
+                                     direction, cellExitTime);
+                }
+            }
+
+            return nearestHit;
+        });
+}
+
+void DefaultRayCast::castBatch(std::span<const Ray> rays, std::span<RayCastResult> results) const
+{
+    if (rays.empty())
     {
-        return {};
+        return;
     }
 
-    const auto collisionArea = buildRect(from, to, lineWidth);
-    const auto colliders = collisions->getCollidersIntersectingWithAreaFromX(collisionArea);
+    auto left = infinity;
+    auto top = infinity;
+    auto right = -infinity;
+    auto bottom = -infinity;
+    components::core::CollisionLayerMask layerMaskOfRays{0};
 
-    if (colliders.empty())
+    for (const auto& ray : rays)
     {
-        return {};
+        layerMaskOfRays |= ray.layerMask;
+        const auto halfLineWidth = ray.lineWidth / 2.f;
+        left = std::min({left, ray.from.x - halfLineWidth, ray.to.x - halfLineWidth});
+        top = std::min({top, ray.from.y - halfLineWidth, ray.to.y - halfLineWidth});
+        right = std::max({right, ray.from.x + halfLineWidth, ray.to.x + halfLineWidth});
+        bottom = std::max({bottom, ray.from.y + halfLineWidth, ray.to.y + halfLineWidth});
     }
 
-    std::vector<sf::Vector2f> linePoints = buildLinePoints(from, to);
+    // colliders are copied once on calling thread, so workers never touch broadphase or components
+    const utils::FloatRect raysArea{left, top, right - left, bottom - top};
+    colliders.clear();
+    collisions->getPossibleCollidersInArea(raysArea, colliders, layerMaskOfRays);
+    snapshot.build(raysArea, colliders);
 
-    for (const auto& linePoint : linePoints)
+    const auto castRays = [&](std::size_t firstRayIndex, std::size_t lastRayIndex)
     {
-        for (const auto& collider : colliders)
-        {
-            if (exclusionID == collider->getOwner().getId())
-            {
-                continue;
-            }
+        std::vector<std::size_t> indicesOfColliders;
 
-            const auto entityRect = collider->getCollisionBox();
-            if (entityRect.contains(linePoint))
-            {
-                RayCastResult result{};
-                result.collision = &(collider->getOwner());
-                return result;
-            }
+        for (auto rayIndex = firstRayIndex; rayIndex < lastRayIndex; rayIndex++)
+        {
+            results[rayIndex] = castInSnapshot(rays[rayIndex], indicesOfColliders);
         }
-    }
+    };
+
+    const auto numberOfChunks = std::clamp<std::size_t>(rays.size() / minimumNumberOfRaysPerThread, 1,
+                                                        workerPool.getNumberOfThreads());
+    const auto numberOfRaysPerChunk = (rays.size() + numberOfChunks - 1) / numberOfChunks;
 
-    return {};
+    workerPool.run(numberOfChunks,
+                   [&](std::size_t chunkIndex)
+                   {
+                       castRays(std::min(rays.size(), chunkIndex * numberOfRaysPerChunk),
+                                std::min(rays.size(), (chunkIndex + 1) * numberOfRaysPerChunk));
+                   });
 }
 
-sf::FloatRect DefaultRayCast::buildRect(const utils::Vector2f& lineOne, const utils::Vector2f& lineTwo,
-                                        float lineWidth) const
+void DefaultRayCast::queue(const Ray& ray, RayCastCallback callback)
 {
-    const float rectWidth = lineWidth;
-    const float halfWidth = rectWidth * 0.5f;
+    queuedRays.push_back(ray);
+    queuedCallbacks.push_back(std::move(callback));
+}
+
+void DefaultRayCast::castQueuedRays()
+{
+    // callbacks may queue rays for next batch, so queues are emptied before any callback is called
+    const auto rays = std::exchange(queuedRays, {});
+    const auto callbacks = std::exchange(queuedCallbacks, {});
 
-    float left, top, width, height;
+    queuedRaysResults.resize(rays.size());
+    castBatch(rays, queuedRaysResults);
 
-    if (lineOne.x == lineTwo.x)
+    for (std::size_t rayIndex = 0; rayIndex < rays.size(); rayIndex++)
     {
-        left = lineOne.x - halfWidth;
-        top = (lineOne.y < lineTwo.y) ? lineOne.y : lineTwo.y;
-        width = rectWidth;
-        height = fabsf(lineOne.y - lineTwo.y);
+        callbacks[rayIndex](queuedRaysResults[rayIndex]);
     }
-    else
+}
+
+RayCastResult DefaultRayCast::castInSnapshot(const Ray& ray,
+                                             std::vector<std::size_t>& indicesOfColliders) const
+{
+    const auto halfLineWidth = ray.lineWidth / 2.f;
+    const auto direction = ray.to - ray.from;
+
+    return findNearestHit(
+        ray.from, ray.to,
+        [&](const utils::FloatRect& cell, float cellExitTime)
+        {
+            indicesOfColliders.clear();
+            snapshot.getCollidersInArea(widen(cell, halfLineWidth), indicesOfColliders);
+
+            std::optional<Hit> nearestHit;
+
+            for (const auto colliderIndex : indicesOfColliders)
+            {
+                const auto& collider = snapshot.getCollider(colliderIndex);
+
+                if (ray.exclusionID != collider.ownerId and (ray.layerMask & collider.layerMask))
+                {
+                    updateNearestHit(nearestHit, collider.owner, collider.box, ray.from, direction,
+                                     cellExitTime);
+                }
+            }
+
+            return nearestHit;
+        });
+}
+
+void DefaultRayCast::updateNearestHit(std::optional<Hit>& nearestHit,
+                                      components::core::ComponentOwner* collision,
+                                      const utils::FloatRect& box, const utils::Vector2f& from,
+                                      const utils::Vector2f& direction, float cellExitTime)
+{
+    // line width widens only broadphase queries, rays hit colliders exactly as they are
+    auto hit = intersectRayWithBox(from, direction, box);
+
+    // hits behind this cell are found again when ray reaches their cell
+    if (hit and hit->time <= cellExitTime and (not nearestHit or hit->time < nearestHit->time))
     {
-        left = (lineOne.x < lineTwo.x) ? lineOne.x : lineTwo.x;
-        top = lineOne.y + halfWidth;
-        width = fabsf(lineOne.x - lineTwo.x);
-        height = rectWidth;
+        hit->collision = collision;
+        nearestHit = hit;
     }
-
-    return {left, top, width, height};
 }
 
-std::vector<sf::Vector2f> DefaultRayCast::buildLinePoints(const utils::Vector2f& from,
-                                                          const utils::Vector2f& to) const
+std::optional<DefaultRayCast::Hit> DefaultRayCast::intersectRayWithBox(const utils::Vector2f& from,
+                                                                       const utils::Vector2f& direction,
+                                                                       const utils::FloatRect& box)
 {
-    std::vector<sf::Vector2f> result;
+    auto entryTime = -infinity;
+    auto exitTime = infinity;
+    utils::Vector2f normal{0, 0};
 
-    sf::Vector2f diff = to - from;
-    int steps = 0;
+    const auto intersectSlab = [&](float origin, float slabDirection, float slabMin, float slabMax,
+                                   const utils::Vector2f& slabNormal)
+    {
+        if (slabDirection == 0)
+        {
+            return origin >= slabMin and origin <= slabMax;
+        }
 
-    float absDiffX = abs(diff.x);
-    float absDiffY = abs(diff.y);
+        auto slabEntryTime = (slabMin - origin) / slabDirection;
+        auto slabExitTime = (slabMax - origin) / slabDirection;
 
-    if (absDiffX > absDiffY)
+        if (slabEntryTime > slabExitTime)
+        {
+            std::swap(slabEntryTime, slabExitTime);
+        }
+
+        if (slabEntryTime > entryTime)
+        {
+            entryTime = slabEntryTime;
+            normal = slabDirection > 0 ? -slabNormal : slabNormal;
+        }
+
+        exitTime = std::min(exitTime, slabExitTime);
+
+        return entryTime <= exitTime;
+    };
+
+    if (not intersectSlab(from.x, direction.x, box.left, box.left + box.width, {1, 0}) or
+        not intersectSlab(from.y, direction.y, box.top, box.top + box.height, {0, 1}))
     {
-        steps = absDiffX;
+        return std::nullopt;
     }
-    else
+
+    if (exitTime < 0 or entryTime > 1)
     {
-        steps = absDiffY;
+        return std::nullopt;
     }
 
-    float xStep = diff.x / (float)steps;
-    float yStep = diff.y / (float)steps;
+    if (entryTime < 0)
+    {
+        return Hit{nullptr, 0, {0, 0}};
+    }
 
-    float newX = from.x;
-    float newY = from.y;
+    return Hit{nullptr, entryTime, normal};
+}
 
-    for (int i = 0; i <= steps; i++)
-    {
-        result.emplace_back(newX, newY);
+utils::FloatRect DefaultRayCast::widen(const utils::FloatRect& box, float halfLineWidth)
+{
+    return {box.left - halfLineWidth, box.top - halfLineWidth, box.width + 2 * halfLineWidth,
+            box.height + 2 * halfLineWidth};
+}
 
-        newX += xStep;
-        newY += yStep;
+template <typename CellHitFinder>
+RayCastResult DefaultRayCast::findNearestHit(const utils::Vector2f& from, const utils::Vector2f& to,
+                                             CellHitFinder&& findNearestHitInCell) const
+{
+    if (from == to)
+    {
+        return {};
     }
 
-    return result;
+    const auto direction = to - from;
+
+    // ray is walked through grid cells in order, so first cell with hit contains nearest hit
+    auto cellX = std::floor(from.x / cellSize);
+    auto cellY = std::floor(from.y / cellSize);
+    const auto stepX = direction.x > 0 ? 1.f : -1.f;
+    const auto stepY = direction.y > 0 ? 1.f : -1.f;
+    const auto cellCrossingTimeX = direction.x != 0 ? cellSize / std::abs(direction.x) : infinity;
+    const auto cellCrossingTimeY = direction.y != 0 ? cellSize / std::abs(direction.y) : infinity;
+    const auto nextCellBorderX = (direction.x > 0 ? cellX + 1 : cellX) * cellSize;
+    const auto nextCellBorderY = (direction.y > 0 ? cellY + 1 : cellY) * cellSize;
+    auto nextCellTimeX = direction.x != 0 ? (nextCellBorderX - from.x) / direction.x : infinity;
+    auto nextCellTimeY = direction.y != 0 ? (nextCellBorderY - from.y) / direction.y : infinity;
+
+    while (true)
+    {
+        const auto cellExitTime = std::min({nextCellTimeX, nextCellTimeY, 1.f});
+        const utils::FloatRect cell{cellX * cellSize, cellY * cellSize, cellSize, cellSize};
+
+        if (const auto hit = findNearestHitInCell(cell, cellExitTime))
+        {
+            const auto length = std::hypot(direction.x, direction.y);
+            return {hit->collision, from + direction * hit->time, hit->normal, hit->time * length};
+        }
+
+        if (cellExitTime >= 1.f)
+        {
+            return {};
+        }
+
+        if (nextCellTimeX < nextCellTimeY)
+        {
+            cellX += stepX;
+            nextCellTimeX += cellCrossingTimeX;
+        }
+        else
+        {
+            cellY += stepY;
+            nextCellTimeY += cellCrossingTimeY;
+        }
+    }
+}
 }
-}
\ No newline at end of file
@@ -1,24 +1,54 @@
 #pragma once
 
+#include <optional>
+
 #include "ComponentOwner.h"
 #include "Quadtree.h"
 #include "RayCast.h"
+#include "RayCastSnapshot.h"
+#include "WorkerPool.h"
 
 namespace physics
 {
+// not reentrant: casts share colliders buffer and snapshot, so one instance must not cast from many threads
 class DefaultRayCast : public RayCast
 {
 public:
-    explicit DefaultRayCast(std::shared_ptr<Quadtree>);
+    explicit DefaultRayCast(std::shared_ptr<Quadtree>, float cellSize = 4.f,
+                            unsigned int numberOfThreads = 0);
 
     RayCastResult cast(const utils::Vector2f& from, const utils::Vector2f& to, unsigned int exclusionID = -1,
                        float lineWidth = 0.2f) const;
+    void castBatch(std::span<const Ray> rays, std::span<RayCastResult> results) const override;
+    void queue(const Ray&, RayCastCallback) override;
+    void castQueuedRays() override;
 
 private:
-    sf::FloatRect buildRect(const utils::Vector2f& lineOne, const utils::Vector2f& lineTwo,
-                            float lineWidth) const;
-    std::vector<sf::Vector2f> buildLinePoints(const utils::Vector2f& from, const utils::Vector2f& to) const;
+    struct Hit
+    {
+        components::core::ComponentOwner* collision;
+        float time;
+        utils::Vector2f normal;
+    };
+
+    RayCastResult castInSnapshot(const Ray&, std::vector<std::size_t>& indicesOfColliders) const;
+    template <typename CellHitFinder>
+    RayCastResult findNearestHit(const utils::Vector2f& from, const utils::Vector2f& to,
+                                 CellHitFinder&& findNearestHitInCell) const;
+    static void updateNearestHit(std::optional<Hit>& nearestHit, components::core::ComponentOwner* collision,
+                                 const utils::FloatRect& box, const utils::Vector2f& from,
+                                 const utils::Vector2f& direction, float cellExitTime);
+    static std::optional<Hit> intersectRayWithBox(const utils::Vector2f& from,
+                                                  const utils::Vector2f& direction, const utils::FloatRect&);
+    static utils::FloatRect widen(const utils::FloatRect&, float halfLineWidth);
 
     std::shared_ptr<Quadtree> collisions;
+    const float cellSize;
+    mutable std::vector<components::core::BoxColliderComponent*> colliders;
+    mutable RayCastSnapshot snapshot;
+    mutable WorkerPool workerPool;
+    std::vector<Ray> queuedRays;
+    std::vector<RayCastCallback> queuedCallbacks;
+    std::vector<RayCastResult> queuedRaysResults;
 };
 }
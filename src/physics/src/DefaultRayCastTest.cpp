@@ -1,5 +1,7 @@
 #include "DefaultRayCast.h"
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "RendererPoolMock.h"
@@ -21,6 +23,7 @@ public:
     const utils::Vector2f position2{26, 20};
     const utils::Vector2f position3{32, 20};
     const utils::Vector2f position4{40, 20};
+    const unsigned int noExclusionID = -1;
     std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
         std::make_shared<NiceMock<graphics::RendererPoolMock>>();
     std::shared_ptr<components::core::SharedContext> sharedContext =
@@ -75,3 +78,180 @@ TEST_F(DefaultRayCastTest, givenTwoObjectsInRangeOnRight_shouldReturnFirstInters
 
     ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent2->getOwner()));
 }
+
+TEST_F(DefaultRayCastTest, givenObjectInRange_shouldReturnHitPointNormalAndDistance)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    quadtree->insertCollider(boxColliderComponent2);
+
+    const auto rayCastResult =
+        rayCast.cast(position1Center, targetPoint1, boxColliderComponent1->getOwnerId(), 0);
+
+    ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent2->getOwner()));
+    ASSERT_FLOAT_EQ(rayCastResult.hitPoint.x, 26);
+    ASSERT_FLOAT_EQ(rayCastResult.hitPoint.y, 22.5);
+    ASSERT_EQ(rayCastResult.normal, utils::Vector2f(-1, 0));
+    ASSERT_FLOAT_EQ(rayCastResult.distance, 3.5);
+}
+
+TEST_F(DefaultRayCastTest, givenRayEndingBeforeObject_shouldReturnNoObject)
+{
+    quadtree->insertCollider(boxColliderComponent2);
+
+    const auto rayCastResult = rayCast.cast(position1Center, {25.5, 22.5}, -1, 0);
+
+    ASSERT_FALSE(rayCastResult.collision);
+}
+
+TEST_F(DefaultRayCastTest, givenWideRayPassingJustNextToObject_shouldReturnNoObject)
+{
+    quadtree->insertCollider(boxColliderComponent2);
+
+    const auto rayCastResult = rayCast.cast({20, 19.5}, {35, 19.5}, -1, 2);
+
+    ASSERT_FALSE(rayCastResult.collision);
+}
+
+TEST_F(DefaultRayCastTest, givenWideRayTouchingEdgeOfObject_shouldReturnHitOnEdge)
+{
+    quadtree->insertCollider(boxColliderComponent2);
+
+    const auto rayCastResult = rayCast.cast({20, 20}, {35, 20}, -1, 2);
+
+    ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent2->getOwner()));
+    ASSERT_FLOAT_EQ(rayCastResult.hitPoint.x, 26);
+}
+
+TEST_F(DefaultRayCastTest, givenVerticalRayGoingUp_shouldReturnHitOnBottomOfObject)
+{
+    quadtree->insertCollider(boxColliderComponent2);
+
+    const auto rayCastResult = rayCast.cast({28.5, 40}, {28.5, 10}, -1, 0);
+
+    ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent2->getOwner()));
+    ASSERT_EQ(rayCastResult.normal, utils::Vector2f(0, 1));
+    ASSERT_FLOAT_EQ(rayCastResult.distance, 15);
+}
+
+TEST_F(DefaultRayCastTest, givenRayCrossingManyCellsToLeft_shouldReturnNearestIntersectedObject)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    quadtree->insertCollider(boxColliderComponent2);
+    quadtree->insertCollider(boxColliderComponent3);
+    quadtree->insertCollider(boxColliderComponent4);
+
+    const auto rayCastResult = rayCast.cast({60, 22.5}, {0, 22.5}, -1, 0);
+
+    ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent4->getOwner()));
+    ASSERT_EQ(rayCastResult.normal, utils::Vector2f(1, 0));
+    ASSERT_FLOAT_EQ(rayCastResult.distance, 15);
+}
+
+TEST_F(DefaultRayCastTest, givenDiagonalRay_shouldReturnHitOnCornerOfObject)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    quadtree->insertCollider(boxColliderComponent3);
+
+    const auto rayCastResult = rayCast.cast({50, 50}, {0, 0}, -1, 0);
+
+    ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent1->getOwner()));
+    ASSERT_FLOAT_EQ(rayCastResult.hitPoint.x, 25);
+    ASSERT_FLOAT_EQ(rayCastResult.hitPoint.y, 25);
+    ASSERT_FLOAT_EQ(rayCastResult.distance, std::hypot(25.f, 25.f));
+}
+
+TEST_F(DefaultRayCastTest, givenRayStartingInsideObject_shouldReturnHitAtStartPoint)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+
+    const auto rayCastResult = rayCast.cast(position1Center, targetPoint1, -1, 0);
+
+    ASSERT_EQ(rayCastResult.collision, &(boxColliderComponent1->getOwner()));
+    ASSERT_EQ(rayCastResult.hitPoint, position1Center);
+    ASSERT_FLOAT_EQ(rayCastResult.distance, 0);
+}
+
+TEST_F(DefaultRayCastTest, castBatch_shouldReturnSameResultsAsSingleCasts)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    quadtree->insertCollider(boxColliderComponent2);
+    quadtree->insertCollider(boxColliderComponent3);
+    quadtree->insertCollider(boxColliderComponent4);
+    std::vector<Ray> rays;
+    for (int rayIndex = 0; rayIndex < 200; rayIndex++)
+    {
+        const auto offset = static_cast<float>(rayIndex % 40) / 4.f;
+        rays.push_back({{10 + offset, 18 + offset}, {60 - offset, 27 - offset / 2}});
+    }
+    std::vector<RayCastResult> results(rays.size());
+
+    rayCast.castBatch(rays, results);
+
+    for (std::size_t rayIndex = 0; rayIndex < rays.size(); rayIndex++)
+    {
+        const auto& ray = rays[rayIndex];
+        const auto expectedResult = rayCast.cast(ray.from, ray.to, ray.exclusionID, ray.lineWidth);
+        ASSERT_EQ(results[rayIndex].collision, expectedResult.collision);
+        ASSERT_EQ(results[rayIndex].hitPoint, expectedResult.hitPoint);
+        ASSERT_EQ(results[rayIndex].normal, expectedResult.normal);
+        ASSERT_FLOAT_EQ(results[rayIndex].distance, expectedResult.distance);
+    }
+}
+
+TEST_F(DefaultRayCastTest, castBatch_shouldSkipExcludedObject)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    quadtree->insertCollider(boxColliderComponent2);
+    const std::vector<Ray> rays{{position1Center, targetPoint1, boxColliderComponent1->getOwnerId()}};
+    std::vector<RayCastResult> results(rays.size());
+
+    rayCast.castBatch(rays, results);
+
+    ASSERT_EQ(results[0].collision, &(boxColliderComponent2->getOwner()));
+}
+
+TEST_F(DefaultRayCastTest, castBatch_shouldSkipObjectsOnLayersOutsideOfMask)
+{
+    const auto playerCollider =
+        std::make_shared<BoxColliderComponent>(&componentOwner2, size, CollisionLayer::Player);
+    quadtree->insertCollider(playerCollider);
+    quadtree->insertCollider(boxColliderComponent3);
+    const std::vector<Ray> rays{
+        {{22.5, 22.5}, {40, 22.5}, noExclusionID, 0, toCollisionLayerMask(CollisionLayer::Default)},
+        {{22.5, 22.5}, {40, 22.5}, noExclusionID, 0, toCollisionLayerMask(CollisionLayer::Tile)}};
+    std::vector<RayCastResult> results(rays.size());
+
+    rayCast.castBatch(rays, results);
+
+    ASSERT_EQ(results[0].collision, &(boxColliderComponent3->getOwner()));
+    ASSERT_FALSE(results[1].collision);
+}
+
+
+TEST_F(DefaultRayCastTest, castQueuedRays_shouldPassResultsOfQueuedRaysToTheirCallbacks)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    quadtree->insertCollider(boxColliderComponent2);
+    std::vector<components::core::ComponentOwner*> collisions;
+    const auto collectCollision = [&](const RayCastResult& result)
+    { collisions.push_back(result.collision); };
+    rayCast.queue({position1Center, targetPoint1}, collectCollision);
+    rayCast.queue({position1Center, targetPoint1, boxColliderComponent1->getOwnerId()}, collectCollision);
+
+    rayCast.castQueuedRays();
+
+    ASSERT_EQ(collisions, (std::vector<components::core::ComponentOwner*>{
+                              &(boxColliderComponent1->getOwner()), &(boxColliderComponent2->getOwner())}));
+}
+
+TEST_F(DefaultRayCastTest, castQueuedRays_shouldNotCastRaysAgain)
+{
+    quadtree->insertCollider(boxColliderComponent1);
+    auto numberOfCallbackCalls = 0;
+    rayCast.queue({position1Center, targetPoint1}, [&](const RayCastResult&) { numberOfCallbackCalls++; });
+
+    rayCast.castQueuedRays();
+    rayCast.castQueuedRays();
+
+    ASSERT_EQ(numberOfCallbackCalls, 1);
+}
\ No newline at end of file
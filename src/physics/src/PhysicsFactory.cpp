@@ -4,8 +4,11 @@
 
 namespace physics
 {
-std::unique_ptr<PhysicsFactory> PhysicsFactory::createPhysicsFactory(const utils::FloatRect& mapBounds)
+std::unique_ptr<PhysicsFactory>
+PhysicsFactory::createPhysicsFactory(const utils::FloatRect& mapBounds,
+                                     const BroadphaseSettings& broadphaseSettings,
+                                     const CollisionSystemSettings& collisionSystemSettings)
 {
-    return std::make_unique<DefaultPhysicsFactory>(mapBounds);
+    return std::make_unique<DefaultPhysicsFactory>(mapBounds, broadphaseSettings, collisionSystemSettings);
 }
 }
\ No newline at end of file
@@ -2,7 +2,9 @@
 
 #include <memory>
 
+#include "BroadphaseSettings.h"
 #include "CollisionSystem.h"
+#include "CollisionSystemSettings.h"
 #include "DefaultRayCast.h"
 #include "PhysicsApi.h"
 
@@ -17,6 +19,8 @@ public:
     virtual std::shared_ptr<RayCast> createRayCast() const = 0;
     virtual std::shared_ptr<Quadtree> getQuadTree() const = 0;
 
-    static std::unique_ptr<PhysicsFactory> createPhysicsFactory(const utils::FloatRect& mapBounds);
+    static std::unique_ptr<PhysicsFactory> createPhysicsFactory(const utils::FloatRect& mapBounds,
+                                                                const BroadphaseSettings& = {},
+                                                                const CollisionSystemSettings& = {});
 };
 }
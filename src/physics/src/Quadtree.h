@@ -1,8 +1,10 @@
 #pragma once
 
 #include <array>
+#include <utility>
 
 #include "BoxColliderComponent.h"
+#include "CollisionLayer.h"
 #include "ComponentOwner.h"
 
 namespace physics
@@ -10,9 +12,13 @@ namespace physics
 class Quadtree
 {
 public:
+    using CollisionPair =
+        std::pair<components::core::BoxColliderComponent*, components::core::BoxColliderComponent*>;
+
     virtual ~Quadtree() = default;
 
     virtual void insertCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) = 0;
+    virtual void updateCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) = 0;
     virtual void removeCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) = 0;
     virtual void clearAllColliders() = 0;
     virtual const utils::FloatRect& getNodeBounds() const = 0;
@@ -20,5 +26,24 @@ public:
     getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const = 0;
     virtual std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
     getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const = 0;
+    // appends to colliders without clearing them, so one buffer can be reused between queries
+    virtual void getCollidersIntersectingWithAreaFromX(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const = 0;
+    virtual void getCollidersIntersectingWithAreaFromY(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const = 0;
+    // possible colliders only share nodes with area, their collision boxes are not checked,
+    // colliders from layers outside of layerMask are skipped before their components are touched
+    virtual void getPossibleCollidersInArea(
+        const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+        components::core::CollisionLayerMask layerMask = components::core::allCollisionLayers) const = 0;
+    // broadphases sweeping all colliders at once append pairs of colliders whose areas of current and next
+    // frame overlap and whose layers collide, other broadphases return false and are queried by area
+    virtual bool getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const = 0;
+    // tiles which never move are not swept into pairs, so they are still queried by area
+    virtual void getPossibleStaticCollidersInArea(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const = 0;
 };
 }
\ No newline at end of file
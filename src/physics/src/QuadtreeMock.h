@@ -11,6 +11,8 @@ class QuadtreeMock : public Quadtree
 public:
     MOCK_METHOD(void, insertCollider, (const std::shared_ptr<components::core::BoxColliderComponent>&),
                 (override));
+    MOCK_METHOD(void, updateCollider, (const std::shared_ptr<components::core::BoxColliderComponent>&),
+                (override));
     MOCK_METHOD(void, removeCollider, (const std::shared_ptr<components::core::BoxColliderComponent>&),
                 (override));
     MOCK_METHOD(void, clearAllColliders, (), ());
@@ -19,5 +21,19 @@ public:
                 getCollidersIntersectingWithAreaFromX, (const utils::FloatRect& area), (const override));
     MOCK_METHOD(std::vector<std::shared_ptr<components::core::BoxColliderComponent>>,
                 getCollidersIntersectingWithAreaFromY, (const utils::FloatRect& area), (const override));
+    MOCK_METHOD(void, getCollidersIntersectingWithAreaFromX,
+                (const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>&),
+                (const override));
+    MOCK_METHOD(void, getCollidersIntersectingWithAreaFromY,
+                (const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>&),
+                (const override));
+    MOCK_METHOD(void, getPossibleCollidersInArea,
+                (const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>&,
+                 components::core::CollisionLayerMask),
+                (const override));
+    MOCK_METHOD(bool, getPossibleCollisionPairs, (std::vector<CollisionPair>&), (const override));
+    MOCK_METHOD(void, getPossibleStaticCollidersInArea,
+                (const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>&),
+                (const override));
 };
 }
\ No newline at end of file
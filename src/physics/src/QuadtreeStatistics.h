@@ -0,0 +1,14 @@
+#pragma once
+
+namespace physics
+{
+struct QuadtreeStatistics
+{
+    int depth;
+    int numberOfNodes;
+    int numberOfLeafNodes;
+    int numberOfColliders;
+    int numberOfCollidersInInnerNodes;
+    int maxNumberOfCollidersInNode;
+};
+}
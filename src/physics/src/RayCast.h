@@ -1,14 +1,32 @@
 #pragma once
 
+#include <functional>
+#include <span>
+
+#include "CollisionLayer.h"
 #include "ComponentOwner.h"
 
 namespace physics
 {
+struct Ray
+{
+    utils::Vector2f from;
+    utils::Vector2f to;
+    unsigned int exclusionID = -1;
+    float lineWidth = 0.2f;
+    components::core::CollisionLayerMask layerMask = components::core::allCollisionLayers;
+};
+
 struct RayCastResult
 {
     components::core::ComponentOwner* collision;
+    utils::Vector2f hitPoint{};
+    utils::Vector2f normal{};
+    float distance{0};
 };
 
+using RayCastCallback = std::function<void(const RayCastResult&)>;
+
 class RayCast
 {
 public:
@@ -16,5 +34,9 @@ public:
 
     virtual RayCastResult cast(const utils::Vector2f& from, const utils::Vector2f& to,
                                unsigned int exclusionID = -1, float lineWidth = 0.2f) const = 0;
+    virtual void castBatch(std::span<const Ray> rays, std::span<RayCastResult> results) const = 0;
+    // queued rays are cast together in one batch, callbacks are called on thread casting queued rays
+    virtual void queue(const Ray&, RayCastCallback) = 0;
+    virtual void castQueuedRays() = 0;
 };
 }
\ No newline at end of file
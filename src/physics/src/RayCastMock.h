@@ -13,5 +13,9 @@ public:
                 (const utils::Vector2f& from, const utils::Vector2f& to, unsigned int exclusionID,
                  float lineWidth),
                 (const override));
+    MOCK_METHOD(void, castBatch, (std::span<const Ray> rays, std::span<RayCastResult> results),
+                (const override));
+    MOCK_METHOD(void, queue, (const Ray&, RayCastCallback), (override));
+    MOCK_METHOD(void, castQueuedRays, (), (override));
 };
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "RayCastSnapshot.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace physics
+{
+
+RayCastSnapshot::RayCastSnapshot(float cellSizeInit)
+    : cellSize{cellSizeInit}, firstCellX{0}, firstCellY{0}, numberOfCellsX{0}, numberOfCellsY{0}
+{
+}
+
+void RayCastSnapshot::build(const utils::FloatRect& area,
+                            const std::vector<components::core::BoxColliderComponent*>& collidersToCopy)
+{
+    firstCellX = static_cast<int>(std::floor(area.left / cellSize));
+    firstCellY = static_cast<int>(std::floor(area.top / cellSize));
+    numberOfCellsX = static_cast<int>(std::floor((area.left + area.width) / cellSize)) - firstCellX + 1;
+    numberOfCellsY = static_cast<int>(std::floor((area.top + area.height) / cellSize)) - firstCellY + 1;
+
+    colliders.clear();
+    for (const auto collider : collidersToCopy)
+    {
+        colliders.push_back({collider->getCollisionBox(), &collider->getOwner(), collider->getOwnerId(),
+                             components::core::toCollisionLayerMask(collider->getCollisionLayer())});
+    }
+
+    const auto visitCellsOfCollider = [&](const Collider& collider, auto&& visitCell)
+    {
+        const auto left = std::max(getCellX(collider.box.left), 0);
+        const auto right = std::min(getCellX(collider.box.left + collider.box.width), numberOfCellsX - 1);
+        const auto top = std::max(getCellY(collider.box.top), 0);
+        const auto bottom = std::min(getCellY(collider.box.top + collider.box.height), numberOfCellsY - 1);
+
+        for (auto cellY = top; cellY <= bottom; cellY++)
+        {
+            for (auto cellX = left; cellX <= right; cellX++)
+            {
+                visitCell(static_cast<std::size_t>(cellY * numberOfCellsX + cellX));
+            }
+        }
+    };
+
+    // counting sort of colliders into cells keeps every cell contiguous in one buffer
+    firstIndicesInCells.assign(static_cast<std::size_t>(numberOfCellsX * numberOfCellsY) + 1, 0);
+
+    for (const auto& collider : colliders)
+    {
+        visitCellsOfCollider(collider, [&](std::size_t cellIndex) { firstIndicesInCells[cellIndex + 1]++; });
+    }
+
+    for (std::size_t cellIndex = 1; cellIndex < firstIndicesInCells.size(); cellIndex++)
+    {
+        firstIndicesInCells[cellIndex] += firstIndicesInCells[cellIndex - 1];
+    }
+
+    indicesOfCollidersInCells.resize(firstIndicesInCells.back());
+    auto nextIndicesInCells = firstIndicesInCells;
+
+    for (std::size_t colliderIndex = 0; colliderIndex < colliders.size(); colliderIndex++)
+    {
+        visitCellsOfCollider(colliders[colliderIndex], [&](std::size_t cellIndex)
+                             { indicesOfCollidersInCells[nextIndicesInCells[cellIndex]++] = colliderIndex; });
+    }
+}
+
+void RayCastSnapshot::getCollidersInArea(const utils::FloatRect& area,
+                                         std::vector<std::size_t>& indicesOfColliders) const
+{
+    const auto left = std::max(getCellX(area.left), 0);
+    const auto right = std::min(getCellX(area.left + area.width), numberOfCellsX - 1);
+    const auto top = std::max(getCellY(area.top), 0);
+    const auto bottom = std::min(getCellY(area.top + area.height), numberOfCellsY - 1);
+
+    for (auto cellY = top; cellY <= bottom; cellY++)
+    {
+        for (auto cellX = left; cellX <= right; cellX++)
+        {
+            const auto cellIndex = static_cast<std::size_t>(cellY * numberOfCellsX + cellX);
+
+            indicesOfColliders.insert(indicesOfColliders.end(),
+                                      indicesOfCollidersInCells.begin() +
+                                          static_cast<std::ptrdiff_t>(firstIndicesInCells[cellIndex]),
+                                      indicesOfCollidersInCells.begin() +
+                                          static_cast<std::ptrdiff_t>(firstIndicesInCells[cellIndex + 1]));
+        }
+    }
+}
+
+const RayCastSnapshot::Collider& RayCastSnapshot::getCollider(std::size_t index) const
+{
+    return colliders[index];
+}
+
+int RayCastSnapshot::getCellX(float x) const
+{
+    return static_cast<int>(std::floor(x / cellSize)) - firstCellX;
+}
+
+int RayCastSnapshot::getCellY(float y) const
+{
+    return static_cast<int>(std::floor(y / cellSize)) - firstCellY;
+}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include "BoxColliderComponent.h"
+#include "Rect.h"
+
+namespace physics
+{
+// immutable copy of colliders binned into grid cells, safe to query from many threads at once
+class RayCastSnapshot
+{
+public:
+    struct Collider
+    {
+        utils::FloatRect box;
+        components::core::ComponentOwner* owner;
+        unsigned int ownerId;
+        components::core::CollisionLayerMask layerMask;
+    };
+
+    explicit RayCastSnapshot(float cellSize);
+
+    void build(const utils::FloatRect& area, const std::vector<components::core::BoxColliderComponent*>&);
+    void getCollidersInArea(const utils::FloatRect& area, std::vector<std::size_t>& indicesOfColliders) const;
+    const Collider& getCollider(std::size_t index) const;
+
+private:
+    int getCellX(float x) const;
+    int getCellY(float y) const;
+
+    const float cellSize;
+    int firstCellX;
+    int firstCellY;
+    int numberOfCellsX;
+    int numberOfCellsY;
+    std::vector<Collider> colliders;
+    std::vector<std::size_t> firstIndicesInCells;
+    std::vector<std::size_t> indicesOfCollidersInCells;
+};
+}
@@ -0,0 +1,70 @@
+#include "RayCastSnapshot.h"
+
+#include "gtest/gtest.h"
+
+#include "RendererPoolMock.h"
+
+using namespace physics;
+using namespace components::core;
+using namespace ::testing;
+
+class RayCastSnapshotTest : public Test
+{
+public:
+    const utils::Vector2f size{5, 5};
+    const utils::Vector2f position1{20, 20};
+    const utils::Vector2f position2{30, 20};
+    const utils::FloatRect area{0, 0, 80, 60};
+    std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<components::core::SharedContext> sharedContext =
+        std::make_shared<components::core::SharedContext>(rendererPool);
+    ComponentOwner componentOwner1{position1, "rayCastSnapshotTest1", sharedContext};
+    ComponentOwner componentOwner2{position2, "rayCastSnapshotTest2", sharedContext};
+    BoxColliderComponent boxColliderComponent1{&componentOwner1, size, CollisionLayer::Player};
+    BoxColliderComponent boxColliderComponent2{&componentOwner2, size};
+    RayCastSnapshot snapshot{4};
+    std::vector<std::size_t> indicesOfColliders;
+};
+
+TEST_F(RayCastSnapshotTest, shouldCopyCollisionBoxOwnerAndLayerOfColliders)
+{
+    snapshot.build(area, {&boxColliderComponent1, &boxColliderComponent2});
+
+    const auto& collider = snapshot.getCollider(0);
+    ASSERT_EQ(collider.box, boxColliderComponent1.getCollisionBox());
+    ASSERT_EQ(collider.owner, &componentOwner1);
+    ASSERT_EQ(collider.ownerId, componentOwner1.getId());
+    ASSERT_EQ(collider.layerMask, toCollisionLayerMask(CollisionLayer::Player));
+}
+
+TEST_F(RayCastSnapshotTest, shouldReturnOnlyCollidersInCellsOverlappingWithArea)
+{
+    snapshot.build(area, {&boxColliderComponent1, &boxColliderComponent2});
+
+    snapshot.getCollidersInArea({18, 18, 3, 3}, indicesOfColliders);
+
+    const std::vector<std::size_t> expectedIndicesOfColliders{0};
+    ASSERT_EQ(indicesOfColliders, expectedIndicesOfColliders);
+}
+
+TEST_F(RayCastSnapshotTest, givenAreaOutsideOfSnapshot_shouldNotReturnAnyColliders)
+{
+    snapshot.build(area, {&boxColliderComponent1, &boxColliderComponent2});
+
+    snapshot.getCollidersInArea({100, 100, 5, 5}, indicesOfColliders);
+
+    ASSERT_TRUE(indicesOfColliders.empty());
+}
+
+TEST_F(RayCastSnapshotTest, rebuiltSnapshot_shouldContainOnlyNewColliders)
+{
+    snapshot.build(area, {&boxColliderComponent1, &boxColliderComponent2});
+
+    snapshot.build(area, {&boxColliderComponent2});
+
+    snapshot.getCollidersInArea({29, 21, 1, 1}, indicesOfColliders);
+    const std::vector<std::size_t> expectedIndicesOfColliders{0};
+    ASSERT_EQ(indicesOfColliders, expectedIndicesOfColliders);
+    ASSERT_EQ(snapshot.getCollider(0).owner, &componentOwner2);
+}
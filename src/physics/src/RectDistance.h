@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cmath>
+
+#include "Rect.h"
+
+namespace physics
+{
+inline double calculateDistanceBetweenRects(const utils::FloatRect& lhs, const utils::FloatRect& rhs)
+{
+    constexpr auto square = [](const double number) { return number * number; };
+    return std::sqrt(square((lhs.top + lhs.height / 2) - (rhs.top + rhs.height / 2)) +
+                     square((lhs.left + lhs.width / 2) - (rhs.left + rhs.width / 2)));
+}
+
+inline bool intersectsWithArea(const utils::FloatRect& area, const utils::FloatRect& colliderBox)
+{
+    return area.intersects(colliderBox) and calculateDistanceBetweenRects(area, colliderBox) != 0.0;
+}
+}
@@ -0,0 +1,282 @@
+#include "SpatialHashGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "RectDistance.h"
+
+namespace physics
+{
+
+SpatialHashGrid::SpatialHashGrid(const utils::FloatRect& boundsInit, float cellSizeInit)
+    : bounds{boundsInit}, cellSize{cellSizeInit}
+{
+}
+
+void SpatialHashGrid::insertCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToInsert)
+{
+    if (placementsOfColliders.contains(colliderToInsert.get()))
+    {
+        updateCollider(colliderToInsert);
+        return;
+    }
+
+    const ColliderPlacement placement{
+        getCellRange(colliderToInsert->getCollisionBox()),
+        components::core::toCollisionLayerMask(colliderToInsert->getCollisionLayer())};
+    placementsOfColliders.insert({colliderToInsert.get(), placement});
+    addToCells(colliderToInsert, placement);
+}
+
+void SpatialHashGrid::updateCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToUpdate)
+{
+    const auto placementOfCollider = placementsOfColliders.find(colliderToUpdate.get());
+
+    if (placementOfCollider == placementsOfColliders.end())
+    {
+        insertCollider(colliderToUpdate);
+        return;
+    }
+
+    const ColliderPlacement currentPlacement{
+        getCellRange(colliderToUpdate->getCollisionBox()),
+        components::core::toCollisionLayerMask(colliderToUpdate->getCollisionLayer())};
+
+    if (currentPlacement == placementOfCollider->second)
+    {
+        return;
+    }
+
+    removeFromCells(colliderToUpdate.get(), placementOfCollider->second.cellsOfCollider);
+    addToCells(colliderToUpdate, currentPlacement);
+    placementOfCollider->second = currentPlacement;
+}
+
+void SpatialHashGrid::removeCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToRemove)
+{
+    const auto placementOfCollider = placementsOfColliders.find(colliderToRemove.get());
+
+    if (placementOfCollider == placementsOfColliders.end())
+    {
+        return;
+    }
+
+    removeFromCells(colliderToRemove.get(), placementOfCollider->second.cellsOfCollider);
+    placementsOfColliders.erase(placementOfCollider);
+}
+
+void SpatialHashGrid::clearAllColliders()
+{
+    for (auto& [_, cellEntries] : cells)
+    {
+        cellEntries.clear();
+    }
+
+    placementsOfColliders.clear();
+}
+
+const utils::FloatRect& SpatialHashGrid::getNodeBounds() const
+{
+    return bounds;
+}
+
+std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+SpatialHashGrid::getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const
+{
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>> collidersIntersectingWithArea;
+
+    visitCollidersFromCellsIntersectingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameXCollisionBox()))
+            {
+                collidersIntersectingWithArea.push_back(possibleCollider);
+            }
+        });
+
+    return collidersIntersectingWithArea;
+}
+
+std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+SpatialHashGrid::getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const
+{
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>> collidersIntersectingWithArea;
+
+    visitCollidersFromCellsIntersectingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameYCollisionBox()))
+            {
+                collidersIntersectingWithArea.push_back(possibleCollider);
+            }
+        });
+
+    return collidersIntersectingWithArea;
+}
+
+void SpatialHashGrid::getCollidersIntersectingWithAreaFromX(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    visitCollidersFromCellsIntersectingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameXCollisionBox()))
+            {
+                colliders.push_back(possibleCollider.get());
+            }
+        });
+}
+
+void SpatialHashGrid::getCollidersIntersectingWithAreaFromY(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    visitCollidersFromCellsIntersectingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameYCollisionBox()))
+            {
+                colliders.push_back(possibleCollider.get());
+            }
+        });
+}
+
+void SpatialHashGrid::getPossibleCollidersInArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+    components::core::CollisionLayerMask layerMask) const
+{
+    visitCollidersFromCellsIntersectingWithArea(
+        area, layerMask,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        { colliders.push_back(possibleCollider.get()); });
+}
+
+bool SpatialHashGrid::getPossibleCollisionPairs(std::vector<CollisionPair>&) const
+{
+    return false;
+}
+
+void SpatialHashGrid::getPossibleStaticCollidersInArea(
+    const utils::FloatRect&, std::vector<components::core::BoxColliderComponent*>&) const
+{
+}
+
+float SpatialHashGrid::getCellSize() const
+{
+    return cellSize;
+}
+
+std::size_t SpatialHashGrid::getNumberOfOccupiedCells() const
+{
+    return cells.size();
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::getCellRange(const utils::FloatRect& area) const
+{
+    const auto firstColumn = static_cast<int>(std::floor(area.left / cellSize));
+    const auto lastColumn =
+        std::max(firstColumn, static_cast<int>(std::ceil((area.left + area.width) / cellSize)) - 1);
+    const auto firstRow = static_cast<int>(std::floor(area.top / cellSize));
+    const auto lastRow =
+        std::max(firstRow, static_cast<int>(std::ceil((area.top + area.height) / cellSize)) - 1);
+
+    return {firstColumn, lastColumn, firstRow, lastRow};
+}
+
+SpatialHashGrid::CellKey SpatialHashGrid::getCellKey(int column, int row)
+{
+    return (static_cast<CellKey>(static_cast<std::uint32_t>(column)) << 32) |
+           static_cast<std::uint32_t>(row);
+}
+
+void SpatialHashGrid::addToCells(const std::shared_ptr<components::core::BoxColliderComponent>& collider,
+                                 const ColliderPlacement& placement)
+{
+    const auto& cellsOfCollider = placement.cellsOfCollider;
+
+    for (int row = cellsOfCollider.firstRow; row <= cellsOfCollider.lastRow; row++)
+    {
+        for (int column = cellsOfCollider.firstColumn; column <= cellsOfCollider.lastColumn; column++)
+        {
+            cells[getCellKey(column, row)].push_back({collider, cellsOfCollider, placement.layerMask});
+        }
+    }
+}
+
+void SpatialHashGrid::removeFromCells(const components::core::BoxColliderComponent* collider,
+                                      const CellRange& cellsOfCollider)
+{
+    for (int row = cellsOfCollider.firstRow; row <= cellsOfCollider.lastRow; row++)
+    {
+        for (int column = cellsOfCollider.firstColumn; column <= cellsOfCollider.lastColumn; column++)
+        {
+            const auto cell = cells.find(getCellKey(column, row));
+
+            if (cell == cells.end())
+            {
+                continue;
+            }
+
+            auto& cellEntries = cell->second;
+            const auto cellEntry = std::find_if(cellEntries.begin(), cellEntries.end(),
+                                                [&](const CellEntry& entry)
+                                                { return entry.collider.get() == collider; });
+
+            if (cellEntry != cellEntries.end())
+            {
+                *cellEntry = std::move(cellEntries.back());
+                cellEntries.pop_back();
+            }
+
+            // emptied cells are erased, so map does not grow with every cell colliders have visited
+            if (cellEntries.empty())
+            {
+                cells.erase(cell);
+            }
+        }
+    }
+}
+
+template <typename Visitor>
+void SpatialHashGrid::visitCollidersFromCellsIntersectingWithArea(
+    const utils::FloatRect& area, components::core::CollisionLayerMask layerMask, Visitor&& visitor) const
+{
+    const auto cellsOfArea = getCellRange(area);
+
+    for (int row = cellsOfArea.firstRow; row <= cellsOfArea.lastRow; row++)
+    {
+        for (int column = cellsOfArea.firstColumn; column <= cellsOfArea.lastColumn; column++)
+        {
+            const auto cell = cells.find(getCellKey(column, row));
+
+            if (cell == cells.end())
+            {
+                continue;
+            }
+
+            for (const auto& cellEntry : cell->second)
+            {
+                // collider spanning several cells is taken only from the first cell shared with area
+                const auto& cellsOfCollider = cellEntry.cellsOfCollider;
+                if (column != std::max(cellsOfCollider.firstColumn, cellsOfArea.firstColumn) or
+                    row != std::max(cellsOfCollider.firstRow, cellsOfArea.firstRow))
+                {
+                    continue;
+                }
+
+                if ((cellEntry.layerMask & layerMask) and cellEntry.collider->isEnabled())
+                {
+                    visitor(cellEntry.collider);
+                }
+            }
+        }
+    }
+}
+
+}
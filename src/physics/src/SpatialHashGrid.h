@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "Quadtree.h"
+
+namespace physics
+{
+class SpatialHashGrid : public Quadtree
+{
+public:
+    explicit SpatialHashGrid(const utils::FloatRect& bounds, float cellSize = 4.f);
+
+    void insertCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void updateCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void removeCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void clearAllColliders() override;
+    const utils::FloatRect& getNodeBounds() const override;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+    getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const override;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+    getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const override;
+    void getCollidersIntersectingWithAreaFromX(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getCollidersIntersectingWithAreaFromY(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getPossibleCollidersInArea(
+        const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+        components::core::CollisionLayerMask layerMask = components::core::allCollisionLayers) const override;
+    bool getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const override;
+    void getPossibleStaticCollidersInArea(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    float getCellSize() const;
+    std::size_t getNumberOfOccupiedCells() const;
+
+private:
+    struct CellRange
+    {
+        int firstColumn;
+        int lastColumn;
+        int firstRow;
+        int lastRow;
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    struct CellEntry
+    {
+        std::shared_ptr<components::core::BoxColliderComponent> collider;
+        CellRange cellsOfCollider;
+        components::core::CollisionLayerMask layerMask;
+    };
+
+    struct ColliderPlacement
+    {
+        CellRange cellsOfCollider;
+        components::core::CollisionLayerMask layerMask;
+
+        bool operator==(const ColliderPlacement&) const = default;
+    };
+
+    using CellKey = std::uint64_t;
+
+    CellRange getCellRange(const utils::FloatRect& area) const;
+    static CellKey getCellKey(int column, int row);
+    void addToCells(const std::shared_ptr<components::core::BoxColliderComponent>&, const ColliderPlacement&);
+    void removeFromCells(const components::core::BoxColliderComponent*, const CellRange&);
+    template <typename Visitor>
+    void visitCollidersFromCellsIntersectingWithArea(const utils::FloatRect& area,
+                                                     components::core::CollisionLayerMask,
+                                                     Visitor&& visitor) const;
+
+    utils::FloatRect bounds;
+    const float cellSize;
+    std::unordered_map<CellKey, std::vector<CellEntry>> cells;
+    std::unordered_map<const components::core::BoxColliderComponent*, ColliderPlacement>
+        placementsOfColliders;
+};
+}
@@ -0,0 +1,209 @@
+#include "SpatialHashGrid.h"
+
+#include "gtest/gtest.h"
+
+#include "RendererPoolMock.h"
+
+using namespace physics;
+using namespace components::core;
+using namespace ::testing;
+
+class SpatialHashGridTest : public Test
+{
+public:
+    const utils::Vector2f size{5, 5};
+    const utils::Vector2f wideSize{20, 5};
+    const utils::Vector2f position1{20, 20};
+    const utils::Vector2f position2{30, 30};
+    const utils::Vector2f positionOutsideOfBounds{-10, -10};
+    const utils::FloatRect gridBounds{0, 0, 80, 60};
+    const utils::FloatRect area1{18, 18, 5, 5};
+    const utils::FloatRect area2{28, 28, 4, 4};
+    const utils::FloatRect areaAlongWideCollider{18, 18, 30, 5};
+    const utils::FloatRect areaOutsideOfBounds{-12, -12, 5, 5};
+    const float cellSize{8.f};
+    std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<components::core::SharedContext> sharedContext =
+        std::make_shared<components::core::SharedContext>(rendererPool);
+    ComponentOwner componentOwner1{position1, "spatialHashGridTest1", sharedContext};
+    ComponentOwner componentOwner2{position2, "spatialHashGridTest2", sharedContext};
+    ComponentOwner componentOwnerOutsideOfBounds{positionOutsideOfBounds, "spatialHashGridTest3",
+                                                 sharedContext};
+    std::shared_ptr<BoxColliderComponent> boxColliderComponent1 =
+        std::make_shared<BoxColliderComponent>(&componentOwner1, size);
+    std::shared_ptr<BoxColliderComponent> boxColliderComponent2 =
+        std::make_shared<BoxColliderComponent>(&componentOwner2, size);
+    std::shared_ptr<BoxColliderComponent> wideBoxColliderComponent =
+        std::make_shared<BoxColliderComponent>(&componentOwner1, wideSize);
+    std::shared_ptr<BoxColliderComponent> boxColliderComponentOutsideOfBounds =
+        std::make_shared<BoxColliderComponent>(&componentOwnerOutsideOfBounds, size);
+    SpatialHashGrid grid{gridBounds, cellSize};
+};
+
+TEST_F(SpatialHashGridTest, givenNoColliders_shouldReturnEmptyColliders)
+{
+    const auto collidersIntersectingWithArea = grid.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_TRUE(collidersIntersectingWithArea.empty());
+}
+
+TEST_F(SpatialHashGridTest, shouldReturnBoundsAndCellSizeSetInConstructor)
+{
+    ASSERT_EQ(grid.getNodeBounds(), gridBounds);
+    ASSERT_EQ(grid.getCellSize(), cellSize);
+}
+
+TEST_F(SpatialHashGridTest, insertedColliderIntersectingWithArea_canBeIntersectedWithArea)
+{
+    grid.insertCollider(boxColliderComponent1);
+    grid.insertCollider(boxColliderComponent2);
+
+    const auto collidersIntersectingWithAreaFromX = grid.getCollidersIntersectingWithAreaFromX(area1);
+    const auto collidersIntersectingWithAreaFromY = grid.getCollidersIntersectingWithAreaFromY(area1);
+
+    ASSERT_EQ(collidersIntersectingWithAreaFromX.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithAreaFromX[0], boxColliderComponent1);
+    ASSERT_EQ(collidersIntersectingWithAreaFromY.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithAreaFromY[0], boxColliderComponent1);
+}
+
+TEST_F(SpatialHashGridTest, removedCollider_canNotBeIntersectedWithArea)
+{
+    grid.insertCollider(boxColliderComponent1);
+    grid.removeCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithArea = grid.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_TRUE(collidersIntersectingWithArea.empty());
+}
+
+TEST_F(SpatialHashGridTest, clearedColliders_shouldReturnEmptyColliders)
+{
+    grid.insertCollider(boxColliderComponent1);
+    grid.insertCollider(boxColliderComponent2);
+    grid.clearAllColliders();
+
+    ASSERT_TRUE(grid.getCollidersIntersectingWithAreaFromX(area1).empty());
+    ASSERT_TRUE(grid.getCollidersIntersectingWithAreaFromX(area2).empty());
+}
+
+TEST_F(SpatialHashGridTest, disabledCollider_shouldNotBeReturned)
+{
+    grid.insertCollider(boxColliderComponent1);
+    boxColliderComponent1->disable();
+
+    const auto collidersIntersectingWithArea = grid.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_TRUE(collidersIntersectingWithArea.empty());
+}
+
+TEST_F(SpatialHashGridTest, updatedColliderThatMoved_canBeIntersectedOnlyWithAreaAtNewPosition)
+{
+    grid.insertCollider(boxColliderComponent1);
+
+    componentOwner1.transform->setPosition(position2);
+    grid.updateCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithOldArea = grid.getCollidersIntersectingWithAreaFromX(area1);
+    const auto collidersIntersectingWithNewArea = grid.getCollidersIntersectingWithAreaFromX(area2);
+    ASSERT_TRUE(collidersIntersectingWithOldArea.empty());
+    ASSERT_EQ(collidersIntersectingWithNewArea.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithNewArea[0], boxColliderComponent1);
+}
+
+TEST_F(SpatialHashGridTest, colliderInsertedTwice_shouldBeReturnedOnce)
+{
+    grid.insertCollider(boxColliderComponent1);
+    grid.insertCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithArea = grid.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_EQ(collidersIntersectingWithArea.size(), 1u);
+}
+
+TEST_F(SpatialHashGridTest, colliderSpanningSeveralCells_shouldBeReturnedOnce)
+{
+    grid.insertCollider(wideBoxColliderComponent);
+
+    const auto collidersIntersectingWithArea =
+        grid.getCollidersIntersectingWithAreaFromX(areaAlongWideCollider);
+
+    ASSERT_EQ(collidersIntersectingWithArea.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithArea[0], wideBoxColliderComponent);
+}
+
+TEST_F(SpatialHashGridTest, colliderOutsideOfBounds_canBeIntersectedWithArea)
+{
+    grid.insertCollider(boxColliderComponentOutsideOfBounds);
+
+    const auto collidersIntersectingWithArea =
+        grid.getCollidersIntersectingWithAreaFromX(areaOutsideOfBounds);
+
+    ASSERT_EQ(collidersIntersectingWithArea.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithArea[0], boxColliderComponentOutsideOfBounds);
+}
+
+TEST_F(SpatialHashGridTest, collidersIntersectingWithArea_shouldBeAppendedToBuffer)
+{
+    grid.insertCollider(boxColliderComponent1);
+    grid.insertCollider(boxColliderComponent2);
+    std::vector<BoxColliderComponent*> collidersIntersectingWithArea{boxColliderComponent2.get()};
+
+    grid.getCollidersIntersectingWithAreaFromX(area1, collidersIntersectingWithArea);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{boxColliderComponent2.get(),
+                                                               boxColliderComponent1.get()};
+    ASSERT_EQ(collidersIntersectingWithArea, expectedColliders);
+}
+
+TEST_F(SpatialHashGridTest, possibleCollidersInArea_shouldSkipCollidersFromLayersOutsideOfMask)
+{
+    boxColliderComponent2->setCollisionLayer(CollisionLayer::Tile);
+    grid.insertCollider(boxColliderComponent1);
+    grid.insertCollider(boxColliderComponent2);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    grid.getPossibleCollidersInArea(gridBounds, possibleColliders,
+                                    toCollisionLayerMask(CollisionLayer::Tile));
+
+    const std::vector<BoxColliderComponent*> expectedColliders{boxColliderComponent2.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(SpatialHashGridTest, updatedColliderWithChangedLayer_shouldBeFilteredByNewLayer)
+{
+    grid.insertCollider(boxColliderComponent1);
+    boxColliderComponent1->setCollisionLayer(CollisionLayer::Tile);
+
+    grid.updateCollider(boxColliderComponent1);
+
+    std::vector<BoxColliderComponent*> defaultColliders;
+    grid.getPossibleCollidersInArea(area1, defaultColliders, toCollisionLayerMask(CollisionLayer::Default));
+    std::vector<BoxColliderComponent*> tileColliders;
+    grid.getPossibleCollidersInArea(area1, tileColliders, toCollisionLayerMask(CollisionLayer::Tile));
+    ASSERT_TRUE(defaultColliders.empty());
+    ASSERT_EQ(tileColliders.size(), 1u);
+}
+
+
+TEST_F(SpatialHashGridTest, removedCollider_shouldNotLeaveEmptyCells)
+{
+    grid.insertCollider(wideBoxColliderComponent);
+
+    grid.removeCollider(wideBoxColliderComponent);
+
+    ASSERT_EQ(grid.getNumberOfOccupiedCells(), 0u);
+}
+
+TEST_F(SpatialHashGridTest, movedCollider_shouldOccupyOnlyCellsOfNewPosition)
+{
+    grid.insertCollider(boxColliderComponent1);
+    componentOwner1.transform->setPosition(position2);
+
+    grid.updateCollider(boxColliderComponent1);
+
+    SpatialHashGrid gridWithColliderAtNewPosition{gridBounds, cellSize};
+    gridWithColliderAtNewPosition.insertCollider(boxColliderComponent1);
+    ASSERT_EQ(grid.getNumberOfOccupiedCells(), gridWithColliderAtNewPosition.getNumberOfOccupiedCells());
+}
\ No newline at end of file
@@ -0,0 +1,295 @@
+#include "StaticCollisionGrid.h"
+
+#include <cmath>
+
+#include "RectDistance.h"
+
+namespace physics
+{
+namespace
+{
+bool containsRect(const utils::FloatRect& outer, const utils::FloatRect& inner)
+{
+    return inner.left >= outer.left && inner.top >= outer.top &&
+           inner.left + inner.width <= outer.left + outer.width &&
+           inner.top + inner.height <= outer.top + outer.height;
+}
+}
+
+StaticCollisionGrid::StaticCollisionGrid(const utils::FloatRect& boundsInit, float cellSizeInit)
+    : bounds{boundsInit}, cellSize{cellSizeInit}
+{
+    numberOfColumns = std::max(1, static_cast<int>(std::ceil(bounds.width / cellSize)));
+    numberOfRows = std::max(1, static_cast<int>(std::ceil(bounds.height / cellSize)));
+    firstEntryInCells.assign(numberOfColumns * numberOfRows, emptyIndex);
+}
+
+void StaticCollisionGrid::insertCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToInsert)
+{
+    if (containsCollider(colliderToInsert))
+    {
+        return;
+    }
+
+    const auto& colliderBounds = colliderToInsert->getCollisionBox();
+
+    if (not containsRect(bounds, colliderBounds))
+    {
+        growToContain(colliderBounds);
+    }
+
+    int colliderIndex;
+
+    if (freeColliderIndices.empty())
+    {
+        colliderIndex = static_cast<int>(colliders.size());
+        colliders.push_back({colliderToInsert, colliderBounds});
+    }
+    else
+    {
+        colliderIndex = freeColliderIndices.back();
+        freeColliderIndices.pop_back();
+        colliders[colliderIndex] = {colliderToInsert, colliderBounds};
+    }
+
+    indicesOfColliders[colliderToInsert.get()] = colliderIndex;
+    linkColliderToCells(colliderIndex);
+}
+
+void StaticCollisionGrid::removeCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToRemove)
+{
+    const auto colliderIndex = indicesOfColliders.find(colliderToRemove.get());
+
+    if (colliderIndex == indicesOfColliders.end())
+    {
+        return;
+    }
+
+    unlinkColliderFromCells(colliderIndex->second);
+    colliders[colliderIndex->second].collider = nullptr;
+    freeColliderIndices.push_back(colliderIndex->second);
+    indicesOfColliders.erase(colliderIndex);
+}
+
+bool StaticCollisionGrid::containsCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& collider) const
+{
+    return indicesOfColliders.contains(collider.get());
+}
+
+void StaticCollisionGrid::clearAllColliders()
+{
+    std::fill(firstEntryInCells.begin(), firstEntryInCells.end(), emptyIndex);
+    cellEntries.clear();
+    freeCellEntryIndices.clear();
+    colliders.clear();
+    freeColliderIndices.clear();
+    indicesOfColliders.clear();
+}
+
+void StaticCollisionGrid::getCollidersIntersectingWithArea(
+    const utils::FloatRect& area,
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>& result) const
+{
+    visitCollidersFromCellsOfArea(area,
+                                  [&](const StaticCollider& staticCollider)
+                                  {
+                                      if (intersectsWithArea(area, staticCollider.bounds))
+                                      {
+                                          result.push_back(staticCollider.collider);
+                                      }
+                                  });
+}
+
+void StaticCollisionGrid::getCollidersIntersectingWithArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& result) const
+{
+    visitCollidersFromCellsOfArea(area,
+                                  [&](const StaticCollider& staticCollider)
+                                  {
+                                      if (intersectsWithArea(area, staticCollider.bounds))
+                                      {
+                                          result.push_back(staticCollider.collider.get());
+                                      }
+                                  });
+}
+
+void StaticCollisionGrid::getPossibleCollidersInArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& result) const
+{
+    visitCollidersFromCellsOfArea(area, [&](const StaticCollider& staticCollider)
+                                  { result.push_back(staticCollider.collider.get()); });
+}
+
+template <typename Visitor>
+void StaticCollisionGrid::visitCollidersFromCellsOfArea(const utils::FloatRect& area, Visitor&& visitor) const
+{
+    const auto areaCells = getCellRange(area);
+
+    for (int row = areaCells.firstRow; row <= areaCells.lastRow; row++)
+    {
+        for (int column = areaCells.firstColumn; column <= areaCells.lastColumn; column++)
+        {
+            auto entryIndex = firstEntryInCells[row * numberOfColumns + column];
+
+            while (entryIndex != emptyIndex)
+            {
+                const auto& cellEntry = cellEntries[entryIndex];
+                entryIndex = cellEntry.nextEntryIndex;
+
+                const auto& staticCollider = colliders[cellEntry.colliderIndex];
+                const auto colliderCells = getCellRange(staticCollider.bounds);
+
+                // collider spanning several cells is reported only from the first cell shared with area
+                const auto firstSharedColumn = std::max(colliderCells.firstColumn, areaCells.firstColumn);
+                const auto firstSharedRow = std::max(colliderCells.firstRow, areaCells.firstRow);
+
+                if (column != firstSharedColumn or row != firstSharedRow)
+                {
+                    continue;
+                }
+
+                if (staticCollider.collider->isEnabled())
+                {
+                    visitor(staticCollider);
+                }
+            }
+        }
+    }
+}
+
+const utils::FloatRect& StaticCollisionGrid::getBounds() const
+{
+    return bounds;
+}
+
+StaticCollisionGrid::CellRange StaticCollisionGrid::getCellRange(const utils::FloatRect& area) const
+{
+    const auto firstColumn = static_cast<int>(std::floor((area.left - bounds.left) / cellSize));
+    const auto lastColumn = std::max(
+        firstColumn, static_cast<int>(std::ceil((area.left + area.width - bounds.left) / cellSize)) - 1);
+    const auto firstRow = static_cast<int>(std::floor((area.top - bounds.top) / cellSize));
+    const auto lastRow = std::max(
+        firstRow, static_cast<int>(std::ceil((area.top + area.height - bounds.top) / cellSize)) - 1);
+
+    return {std::max(firstColumn, 0), std::min(lastColumn, numberOfColumns - 1), std::max(firstRow, 0),
+            std::min(lastRow, numberOfRows - 1)};
+}
+
+void StaticCollisionGrid::growToContain(const utils::FloatRect& area)
+{
+    const auto right = bounds.left + bounds.width;
+    const auto bottom = bounds.top + bounds.height;
+
+    auto newLeft = std::min(bounds.left, area.left);
+    auto newTop = std::min(bounds.top, area.top);
+    auto newRight = std::max(right, area.left + area.width);
+    auto newBottom = std::max(bottom, area.top + area.height);
+
+    // grow at least twice at once, tiles are usually inserted column by column
+    if (newRight - newLeft > bounds.width)
+    {
+        const auto newWidth = std::max(newRight - newLeft, 2 * bounds.width);
+
+        if (newLeft < bounds.left)
+        {
+            newLeft = newRight - newWidth;
+        }
+        else
+        {
+            newRight = newLeft + newWidth;
+        }
+    }
+
+    if (newBottom - newTop > bounds.height)
+    {
+        const auto newHeight = std::max(newBottom - newTop, 2 * bounds.height);
+
+        if (newTop < bounds.top)
+        {
+            newTop = newBottom - newHeight;
+        }
+        else
+        {
+            newBottom = newTop + newHeight;
+        }
+    }
+
+    // keep cells aligned with previous grid
+    newLeft = bounds.left - std::ceil((bounds.left - newLeft) / cellSize) * cellSize;
+    newTop = bounds.top - std::ceil((bounds.top - newTop) / cellSize) * cellSize;
+
+    bounds = utils::FloatRect{newLeft, newTop, newRight - newLeft, newBottom - newTop};
+    numberOfColumns = std::max(1, static_cast<int>(std::ceil(bounds.width / cellSize)));
+    numberOfRows = std::max(1, static_cast<int>(std::ceil(bounds.height / cellSize)));
+    firstEntryInCells.assign(numberOfColumns * numberOfRows, emptyIndex);
+    cellEntries.clear();
+    freeCellEntryIndices.clear();
+
+    for (int colliderIndex = 0; colliderIndex < static_cast<int>(colliders.size()); colliderIndex++)
+    {
+        if (colliders[colliderIndex].collider)
+        {
+            linkColliderToCells(colliderIndex);
+        }
+    }
+}
+
+void StaticCollisionGrid::linkColliderToCells(int colliderIndex)
+{
+    const auto colliderCells = getCellRange(colliders[colliderIndex].bounds);
+
+    for (int row = colliderCells.firstRow; row <= colliderCells.lastRow; row++)
+    {
+        for (int column = colliderCells.firstColumn; column <= colliderCells.lastColumn; column++)
+        {
+            auto& firstEntryInCell = firstEntryInCells[row * numberOfColumns + column];
+
+            // entries of removed colliders are reused, so inserting and removing does not grow entries
+            if (freeCellEntryIndices.empty())
+            {
+                cellEntries.push_back({colliderIndex, firstEntryInCell});
+                firstEntryInCell = static_cast<int>(cellEntries.size()) - 1;
+            }
+            else
+            {
+                const auto cellEntryIndex = freeCellEntryIndices.back();
+                freeCellEntryIndices.pop_back();
+                cellEntries[cellEntryIndex] = {colliderIndex, firstEntryInCell};
+                firstEntryInCell = cellEntryIndex;
+            }
+        }
+    }
+}
+
+void StaticCollisionGrid::unlinkColliderFromCells(int colliderIndex)
+{
+    const auto colliderCells = getCellRange(colliders[colliderIndex].bounds);
+
+    for (int row = colliderCells.firstRow; row <= colliderCells.lastRow; row++)
+    {
+        for (int column = colliderCells.firstColumn; column <= colliderCells.lastColumn; column++)
+        {
+            auto* entryIndex = &firstEntryInCells[row * numberOfColumns + column];
+
+            while (*entryIndex != emptyIndex)
+            {
+                auto& cellEntry = cellEntries[*entryIndex];
+
+                if (cellEntry.colliderIndex == colliderIndex)
+                {
+                    freeCellEntryIndices.push_back(*entryIndex);
+                    *entryIndex = cellEntry.nextEntryIndex;
+                }
+                else
+                {
+                    entryIndex = &cellEntry.nextEntryIndex;
+                }
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "BoxColliderComponent.h"
+
+namespace physics
+{
+class StaticCollisionGrid
+{
+public:
+    explicit StaticCollisionGrid(const utils::FloatRect& bounds, float cellSize = 4.f);
+
+    void insertCollider(const std::shared_ptr<components::core::BoxColliderComponent>&);
+    void removeCollider(const std::shared_ptr<components::core::BoxColliderComponent>&);
+    bool containsCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) const;
+    void clearAllColliders();
+    void getCollidersIntersectingWithArea(
+        const utils::FloatRect& area,
+        std::vector<std::shared_ptr<components::core::BoxColliderComponent>>& result) const;
+    void getCollidersIntersectingWithArea(const utils::FloatRect& area,
+                                          std::vector<components::core::BoxColliderComponent*>& result) const;
+    void getPossibleCollidersInArea(const utils::FloatRect& area,
+                                    std::vector<components::core::BoxColliderComponent*>& result) const;
+    const utils::FloatRect& getBounds() const;
+
+private:
+    struct StaticCollider
+    {
+        std::shared_ptr<components::core::BoxColliderComponent> collider;
+        utils::FloatRect bounds;
+    };
+
+    struct CellEntry
+    {
+        int colliderIndex;
+        int nextEntryIndex;
+    };
+
+    struct CellRange
+    {
+        int firstColumn;
+        int lastColumn;
+        int firstRow;
+        int lastRow;
+    };
+
+    template <typename Visitor>
+    void visitCollidersFromCellsOfArea(const utils::FloatRect& area, Visitor&& visitor) const;
+    CellRange getCellRange(const utils::FloatRect& area) const;
+    void growToContain(const utils::FloatRect& area);
+    void linkColliderToCells(int colliderIndex);
+    void unlinkColliderFromCells(int colliderIndex);
+
+    utils::FloatRect bounds;
+    const float cellSize;
+    int numberOfColumns;
+    int numberOfRows;
+    std::vector<int> firstEntryInCells;
+    std::vector<CellEntry> cellEntries;
+    std::vector<int> freeCellEntryIndices;
+    std::vector<StaticCollider> colliders;
+    std::vector<int> freeColliderIndices;
+    std::unordered_map<const components::core::BoxColliderComponent*, int> indicesOfColliders;
+
+    static constexpr int emptyIndex = -1;
+};
+}
@@ -0,0 +1,124 @@
+#include "StaticCollisionGrid.h"
+
+#include "gtest/gtest.h"
+
+#include "RendererPoolMock.h"
+
+using namespace physics;
+using namespace components::core;
+using namespace ::testing;
+
+class StaticCollisionGridTest : public Test
+{
+public:
+    const utils::Vector2f tileSize{4, 4};
+    const utils::Vector2f wideSize{10, 4};
+    const utils::Vector2f position1{20, 20};
+    const utils::Vector2f position2{24, 20};
+    const utils::Vector2f positionOutsideOfGrid{300, 100};
+    const utils::FloatRect gridBounds{0, 0, 160, 60};
+    const utils::FloatRect area1{19, 19, 3, 3};
+    const utils::FloatRect areaAroundTwoTiles{19, 19, 10, 6};
+    const utils::FloatRect areaOutsideOfGrid{299, 99, 3, 3};
+    std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<components::core::SharedContext> sharedContext =
+        std::make_shared<components::core::SharedContext>(rendererPool);
+    ComponentOwner componentOwner1{position1, "staticCollisionGridTest1", sharedContext};
+    ComponentOwner componentOwner2{position2, "staticCollisionGridTest2", sharedContext};
+    ComponentOwner componentOwnerOutsideOfGrid{positionOutsideOfGrid, "staticCollisionGridTest3",
+                                               sharedContext};
+    std::shared_ptr<BoxColliderComponent> tileCollider1 =
+        std::make_shared<BoxColliderComponent>(&componentOwner1, tileSize, CollisionLayer::Tile);
+    std::shared_ptr<BoxColliderComponent> tileCollider2 =
+        std::make_shared<BoxColliderComponent>(&componentOwner2, tileSize, CollisionLayer::Tile);
+    std::shared_ptr<BoxColliderComponent> wideCollider =
+        std::make_shared<BoxColliderComponent>(&componentOwner1, wideSize, CollisionLayer::Tile);
+    std::shared_ptr<BoxColliderComponent> colliderOutsideOfGrid =
+        std::make_shared<BoxColliderComponent>(&componentOwnerOutsideOfGrid, tileSize, CollisionLayer::Tile);
+    std::vector<std::shared_ptr<BoxColliderComponent>> result;
+    StaticCollisionGrid grid{gridBounds};
+};
+
+TEST_F(StaticCollisionGridTest, givenNoColliders_shouldReturnEmptyColliders)
+{
+    grid.getCollidersIntersectingWithArea(area1, result);
+
+    ASSERT_TRUE(result.empty());
+}
+
+TEST_F(StaticCollisionGridTest, insertedColliderIntersectingWithArea_shouldBeReturned)
+{
+    grid.insertCollider(tileCollider1);
+
+    grid.getCollidersIntersectingWithArea(area1, result);
+
+    ASSERT_EQ(result.size(), 1u);
+    ASSERT_EQ(result[0], tileCollider1);
+}
+
+TEST_F(StaticCollisionGridTest, removedCollider_shouldNotBeReturned)
+{
+    grid.insertCollider(tileCollider1);
+    grid.removeCollider(tileCollider1);
+
+    grid.getCollidersIntersectingWithArea(area1, result);
+
+    ASSERT_TRUE(result.empty());
+    ASSERT_FALSE(grid.containsCollider(tileCollider1));
+}
+
+TEST_F(StaticCollisionGridTest, collidersInsertedAfterRemovals_shouldBeReturnedFromReusedCellEntries)
+{
+    grid.insertCollider(wideCollider);
+    grid.insertCollider(tileCollider2);
+    grid.removeCollider(wideCollider);
+    grid.insertCollider(tileCollider1);
+    grid.removeCollider(tileCollider2);
+    grid.insertCollider(tileCollider2);
+
+    grid.getCollidersIntersectingWithArea(areaAroundTwoTiles, result);
+
+    ASSERT_THAT(result, UnorderedElementsAre(tileCollider1, tileCollider2));
+}
+
+TEST_F(StaticCollisionGridTest, colliderSpanningSeveralCells_shouldBeReturnedOnce)
+{
+    grid.insertCollider(wideCollider);
+
+    grid.getCollidersIntersectingWithArea(areaAroundTwoTiles, result);
+
+    ASSERT_EQ(result.size(), 1u);
+}
+
+TEST_F(StaticCollisionGridTest, neighbouringTilesIntersectingWithArea_shouldBothBeReturned)
+{
+    grid.insertCollider(tileCollider1);
+    grid.insertCollider(tileCollider2);
+
+    grid.getCollidersIntersectingWithArea(areaAroundTwoTiles, result);
+
+    ASSERT_EQ(result.size(), 2u);
+}
+
+TEST_F(StaticCollisionGridTest, colliderOutsideOfBounds_shouldGrowGridAndBeReturned)
+{
+    grid.insertCollider(tileCollider1);
+    grid.insertCollider(colliderOutsideOfGrid);
+
+    grid.getCollidersIntersectingWithArea(areaOutsideOfGrid, result);
+    grid.getCollidersIntersectingWithArea(area1, result);
+
+    ASSERT_EQ(result.size(), 2u);
+    ASSERT_GE(grid.getBounds().width, positionOutsideOfGrid.x + tileSize.x);
+}
+
+TEST_F(StaticCollisionGridTest, disabledCollider_shouldNotBeReturned)
+{
+    grid.insertCollider(tileCollider1);
+    tileCollider1->disable();
+
+    grid.getCollidersIntersectingWithArea(area1, result);
+
+    ASSERT_TRUE(result.empty());
+}
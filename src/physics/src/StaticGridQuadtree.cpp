@@ -0,0 +1,125 @@
+#include "StaticGridQuadtree.h"
+
+namespace physics
+{
+
+StaticGridQuadtree::StaticGridQuadtree(std::unique_ptr<Quadtree> dynamicCollidersInit,
+                                       const utils::FloatRect& bounds, float staticGridCellSize)
+    : dynamicColliders{std::move(dynamicCollidersInit)}, staticColliders{bounds, staticGridCellSize}
+{
+}
+
+void StaticGridQuadtree::insertCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToInsert)
+{
+    if (isStaticTile(*colliderToInsert))
+    {
+        staticColliders.insertCollider(colliderToInsert);
+        return;
+    }
+
+    dynamicColliders->insertCollider(colliderToInsert);
+}
+
+void StaticGridQuadtree::updateCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToUpdate)
+{
+    if (staticColliders.containsCollider(colliderToUpdate))
+    {
+        return;
+    }
+
+    if (isStaticTile(*colliderToUpdate))
+    {
+        staticColliders.insertCollider(colliderToUpdate);
+        return;
+    }
+
+    dynamicColliders->updateCollider(colliderToUpdate);
+}
+
+void StaticGridQuadtree::removeCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToRemove)
+{
+    if (staticColliders.containsCollider(colliderToRemove))
+    {
+        staticColliders.removeCollider(colliderToRemove);
+        return;
+    }
+
+    dynamicColliders->removeCollider(colliderToRemove);
+}
+
+void StaticGridQuadtree::clearAllColliders()
+{
+    staticColliders.clearAllColliders();
+    dynamicColliders->clearAllColliders();
+}
+
+const utils::FloatRect& StaticGridQuadtree::getNodeBounds() const
+{
+    return dynamicColliders->getNodeBounds();
+}
+
+std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+StaticGridQuadtree::getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const
+{
+    auto collidersIntersectingWithArea = dynamicColliders->getCollidersIntersectingWithAreaFromX(area);
+    staticColliders.getCollidersIntersectingWithArea(area, collidersIntersectingWithArea);
+    return collidersIntersectingWithArea;
+}
+
+std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+StaticGridQuadtree::getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const
+{
+    auto collidersIntersectingWithArea = dynamicColliders->getCollidersIntersectingWithAreaFromY(area);
+    staticColliders.getCollidersIntersectingWithArea(area, collidersIntersectingWithArea);
+    return collidersIntersectingWithArea;
+}
+
+void StaticGridQuadtree::getCollidersIntersectingWithAreaFromX(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    dynamicColliders->getCollidersIntersectingWithAreaFromX(area, colliders);
+    staticColliders.getCollidersIntersectingWithArea(area, colliders);
+}
+
+void StaticGridQuadtree::getCollidersIntersectingWithAreaFromY(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    dynamicColliders->getCollidersIntersectingWithAreaFromY(area, colliders);
+    staticColliders.getCollidersIntersectingWithArea(area, colliders);
+}
+
+void StaticGridQuadtree::getPossibleCollidersInArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+    components::core::CollisionLayerMask layerMask) const
+{
+    dynamicColliders->getPossibleCollidersInArea(area, colliders, layerMask);
+
+    // static grid holds only tiles
+    if (layerMask & components::core::toCollisionLayerMask(components::core::CollisionLayer::Tile))
+    {
+        staticColliders.getPossibleCollidersInArea(area, colliders);
+    }
+}
+
+bool StaticGridQuadtree::getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const
+{
+    return dynamicColliders->getPossibleCollisionPairs(collisionPairs);
+}
+
+void StaticGridQuadtree::getPossibleStaticCollidersInArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    staticColliders.getPossibleCollidersInArea(area, colliders);
+}
+
+bool StaticGridQuadtree::isStaticTile(const components::core::BoxColliderComponent& collider)
+{
+    return collider.getCollisionLayer() == components::core::CollisionLayer::Tile and
+           not collider.getOwner().getComponent<components::core::MovementComponent>() and
+           not collider.getOwner().getComponent<components::core::VelocityComponent>();
+}
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Quadtree.h"
+#include "StaticCollisionGrid.h"
+
+namespace physics
+{
+class StaticGridQuadtree : public Quadtree
+{
+public:
+    StaticGridQuadtree(std::unique_ptr<Quadtree> dynamicColliders, const utils::FloatRect& bounds,
+                       float staticGridCellSize = 4.f);
+
+    void insertCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void updateCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void removeCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void clearAllColliders() override;
+    const utils::FloatRect& getNodeBounds() const override;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+    getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const override;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+    getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const override;
+    void getCollidersIntersectingWithAreaFromX(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getCollidersIntersectingWithAreaFromY(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getPossibleCollidersInArea(
+        const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+        components::core::CollisionLayerMask layerMask = components::core::allCollisionLayers) const override;
+    bool getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const override;
+    void getPossibleStaticCollidersInArea(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+
+private:
+    static bool isStaticTile(const components::core::BoxColliderComponent&);
+
+    std::unique_ptr<Quadtree> dynamicColliders;
+    StaticCollisionGrid staticColliders;
+};
+}
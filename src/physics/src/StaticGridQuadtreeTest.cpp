@@ -0,0 +1,154 @@
+#include "StaticGridQuadtree.h"
+
+#include "gtest/gtest.h"
+
+#include "QuadtreeMock.h"
+#include "RendererPoolMock.h"
+
+using namespace physics;
+using namespace components::core;
+using namespace ::testing;
+
+class StaticGridQuadtreeTest : public Test
+{
+public:
+    StaticGridQuadtreeTest()
+    {
+        componentOwnerWithMovingTile.addComponent<VelocityComponent>(6);
+    }
+
+    const utils::Vector2f size{4, 4};
+    const utils::Vector2f position1{20, 20};
+    const utils::Vector2f position2{22, 22};
+    const utils::FloatRect bounds{0, 0, 160, 60};
+    const utils::FloatRect area1{18, 18, 5, 5};
+    std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<components::core::SharedContext> sharedContext =
+        std::make_shared<components::core::SharedContext>(rendererPool);
+    ComponentOwner componentOwnerWithStaticTile{position1, "staticGridQuadtreeTest1", sharedContext};
+    ComponentOwner componentOwnerWithMovingTile{position2, "staticGridQuadtreeTest2", sharedContext};
+    ComponentOwner componentOwnerWithDefaultCollider{position2, "staticGridQuadtreeTest3", sharedContext};
+    std::shared_ptr<BoxColliderComponent> staticTileCollider =
+        std::make_shared<BoxColliderComponent>(&componentOwnerWithStaticTile, size, CollisionLayer::Tile);
+    std::shared_ptr<BoxColliderComponent> movingTileCollider =
+        std::make_shared<BoxColliderComponent>(&componentOwnerWithMovingTile, size, CollisionLayer::Tile);
+    std::shared_ptr<BoxColliderComponent> defaultCollider =
+        std::make_shared<BoxColliderComponent>(&componentOwnerWithDefaultCollider, size);
+    std::unique_ptr<StrictMock<QuadtreeMock>> dynamicCollidersInit =
+        std::make_unique<StrictMock<QuadtreeMock>>();
+    StrictMock<QuadtreeMock>* dynamicColliders = dynamicCollidersInit.get();
+    StaticGridQuadtree quadtree{std::move(dynamicCollidersInit), bounds};
+};
+
+TEST_F(StaticGridQuadtreeTest, staticTile_shouldNotBeInsertedIntoDynamicColliders)
+{
+    quadtree.insertCollider(staticTileCollider);
+}
+
+TEST_F(StaticGridQuadtreeTest, movingTile_shouldBeInsertedIntoDynamicColliders)
+{
+    EXPECT_CALL(*dynamicColliders, insertCollider(movingTileCollider));
+
+    quadtree.insertCollider(movingTileCollider);
+}
+
+TEST_F(StaticGridQuadtreeTest, defaultCollider_shouldBeInsertedIntoDynamicColliders)
+{
+    EXPECT_CALL(*dynamicColliders, insertCollider(defaultCollider));
+
+    quadtree.insertCollider(defaultCollider);
+}
+
+TEST_F(StaticGridQuadtreeTest, updateOfStaticTile_shouldNotTouchDynamicColliders)
+{
+    quadtree.insertCollider(staticTileCollider);
+
+    quadtree.updateCollider(staticTileCollider);
+}
+
+TEST_F(StaticGridQuadtreeTest, removalOfStaticTile_shouldNotTouchDynamicColliders)
+{
+    quadtree.insertCollider(staticTileCollider);
+
+    quadtree.removeCollider(staticTileCollider);
+}
+
+TEST_F(StaticGridQuadtreeTest, collidersIntersectingWithArea_shouldBeTakenFromDynamicCollidersAndStaticTiles)
+{
+    quadtree.insertCollider(staticTileCollider);
+    const std::vector<std::shared_ptr<BoxColliderComponent>> dynamicCollidersInArea{defaultCollider};
+    EXPECT_CALL(*dynamicColliders, getCollidersIntersectingWithAreaFromX(area1))
+        .WillOnce(Return(dynamicCollidersInArea));
+
+    const auto collidersIntersectingWithArea = quadtree.getCollidersIntersectingWithAreaFromX(area1);
+
+    const std::vector<std::shared_ptr<BoxColliderComponent>> expectedColliders{defaultCollider,
+                                                                               staticTileCollider};
+    ASSERT_EQ(collidersIntersectingWithArea, expectedColliders);
+}
+
+TEST_F(StaticGridQuadtreeTest,
+       collidersIntersectingWithAreaPutIntoBuffer_shouldBeTakenFromDynamicCollidersAndStaticTiles)
+{
+    quadtree.insertCollider(staticTileCollider);
+    std::vector<BoxColliderComponent*> collidersIntersectingWithArea;
+    EXPECT_CALL(*dynamicColliders, getCollidersIntersectingWithAreaFromY(area1, _))
+        .WillOnce(Invoke([&](const utils::FloatRect&, std::vector<BoxColliderComponent*>& colliders)
+                         { colliders.push_back(defaultCollider.get()); }));
+
+    quadtree.getCollidersIntersectingWithAreaFromY(area1, collidersIntersectingWithArea);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{defaultCollider.get(),
+                                                               staticTileCollider.get()};
+    ASSERT_EQ(collidersIntersectingWithArea, expectedColliders);
+}
+
+TEST_F(StaticGridQuadtreeTest, possibleCollidersInArea_shouldBeTakenFromDynamicCollidersAndStaticTiles)
+{
+    quadtree.insertCollider(staticTileCollider);
+    std::vector<BoxColliderComponent*> possibleColliders;
+    EXPECT_CALL(*dynamicColliders, getPossibleCollidersInArea(area1, _, allCollisionLayers))
+        .WillOnce(Invoke([&](const utils::FloatRect&, std::vector<BoxColliderComponent*>& colliders,
+                             CollisionLayerMask) { colliders.push_back(defaultCollider.get()); }));
+
+    quadtree.getPossibleCollidersInArea(area1, possibleColliders);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{defaultCollider.get(),
+                                                               staticTileCollider.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(StaticGridQuadtreeTest, possibleCollidersInAreaWithLayerMaskWithoutTiles_shouldNotContainStaticTiles)
+{
+    const auto layerMask = toCollisionLayerMask(CollisionLayer::Default);
+    quadtree.insertCollider(staticTileCollider);
+    std::vector<BoxColliderComponent*> possibleColliders;
+    EXPECT_CALL(*dynamicColliders, getPossibleCollidersInArea(area1, _, layerMask));
+
+    quadtree.getPossibleCollidersInArea(area1, possibleColliders, layerMask);
+
+    ASSERT_TRUE(possibleColliders.empty());
+}
+
+
+TEST_F(StaticGridQuadtreeTest, possibleCollisionPairs_shouldBeTakenFromDynamicColliders)
+{
+    std::vector<Quadtree::CollisionPair> collisionPairs;
+    EXPECT_CALL(*dynamicColliders, getPossibleCollisionPairs(_)).WillOnce(Return(true));
+
+    ASSERT_TRUE(quadtree.getPossibleCollisionPairs(collisionPairs));
+}
+
+TEST_F(StaticGridQuadtreeTest, possibleStaticCollidersInArea_shouldContainOnlyStaticTiles)
+{
+    EXPECT_CALL(*dynamicColliders, insertCollider(movingTileCollider));
+    quadtree.insertCollider(staticTileCollider);
+    quadtree.insertCollider(movingTileCollider);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    quadtree.getPossibleStaticCollidersInArea(area1, possibleColliders);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{staticTileCollider.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
\ No newline at end of file
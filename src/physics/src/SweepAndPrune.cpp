@@ -0,0 +1,303 @@
+#include "SweepAndPrune.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "CollisionLayerMatrix.h"
+#include "RectDistance.h"
+
+namespace physics
+{
+
+namespace
+{
+// dead entries are erased when they make up this part of all entries
+const std::size_t deadEntriesRatioToRemove = 4;
+}
+
+SweepAndPrune::SweepAndPrune(const utils::FloatRect& boundsInit) : bounds{boundsInit}, numberOfDeadEntries{0}
+{
+}
+
+void SweepAndPrune::insertCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToInsert)
+{
+    if (indicesOfEntries.contains(colliderToInsert.get()))
+    {
+        updateCollider(colliderToInsert);
+        return;
+    }
+
+    entries.push_back(createEntry(colliderToInsert));
+    indicesOfEntries.insert({colliderToInsert.get(), entries.size() - 1});
+    widthsOfEntries.insert(getWidth(entries.back()));
+    moveIntoSortedPosition(entries.size() - 1);
+}
+
+void SweepAndPrune::updateCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToUpdate)
+{
+    const auto entryIndex = indicesOfEntries.find(colliderToUpdate.get());
+
+    if (entryIndex == indicesOfEntries.end())
+    {
+        insertCollider(colliderToUpdate);
+        return;
+    }
+
+    auto& entry = entries[entryIndex->second];
+    const auto previousWidth = getWidth(entry);
+    entry = createEntry(colliderToUpdate);
+
+    // node is moved to its new place, so updating width of moving collider does not allocate
+    if (const auto width = getWidth(entry); width != previousWidth)
+    {
+        auto widthNode = widthsOfEntries.extract(widthsOfEntries.find(previousWidth));
+        widthNode.value() = width;
+        widthsOfEntries.insert(std::move(widthNode));
+    }
+
+    moveIntoSortedPosition(entryIndex->second);
+}
+
+void SweepAndPrune::removeCollider(
+    const std::shared_ptr<components::core::BoxColliderComponent>& colliderToRemove)
+{
+    const auto entryIndex = indicesOfEntries.find(colliderToRemove.get());
+
+    if (entryIndex == indicesOfEntries.end())
+    {
+        return;
+    }
+
+    // dead entry keeps its left edge, so entries stay sorted
+    auto& removedEntry = entries[entryIndex->second];
+    indicesOfEntries.erase(entryIndex);
+    widthsOfEntries.erase(widthsOfEntries.find(getWidth(removedEntry)));
+    removedEntry.collider.reset();
+    numberOfDeadEntries++;
+
+    if (numberOfDeadEntries * deadEntriesRatioToRemove >= entries.size())
+    {
+        removeDeadEntries();
+    }
+}
+
+void SweepAndPrune::clearAllColliders()
+{
+    entries.clear();
+    indicesOfEntries.clear();
+    widthsOfEntries.clear();
+    numberOfDeadEntries = 0;
+}
+
+const utils::FloatRect& SweepAndPrune::getNodeBounds() const
+{
+    return bounds;
+}
+
+std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+SweepAndPrune::getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const
+{
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>> collidersIntersectingWithArea;
+
+    visitCollidersOverlappingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameXCollisionBox()))
+            {
+                collidersIntersectingWithArea.push_back(possibleCollider);
+            }
+        });
+
+    return collidersIntersectingWithArea;
+}
+
+std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+SweepAndPrune::getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const
+{
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>> collidersIntersectingWithArea;
+
+    visitCollidersOverlappingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameYCollisionBox()))
+            {
+                collidersIntersectingWithArea.push_back(possibleCollider);
+            }
+        });
+
+    return collidersIntersectingWithArea;
+}
+
+void SweepAndPrune::getCollidersIntersectingWithAreaFromX(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    visitCollidersOverlappingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameXCollisionBox()))
+            {
+                colliders.push_back(possibleCollider.get());
+            }
+        });
+}
+
+void SweepAndPrune::getCollidersIntersectingWithAreaFromY(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders) const
+{
+    visitCollidersOverlappingWithArea(
+        area, components::core::allCollisionLayers,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        {
+            if (intersectsWithArea(area, possibleCollider->getNextFrameYCollisionBox()))
+            {
+                colliders.push_back(possibleCollider.get());
+            }
+        });
+}
+
+void SweepAndPrune::getPossibleCollidersInArea(
+    const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+    components::core::CollisionLayerMask layerMask) const
+{
+    visitCollidersOverlappingWithArea(
+        area, layerMask,
+        [&](const std::shared_ptr<components::core::BoxColliderComponent>& possibleCollider)
+        { colliders.push_back(possibleCollider.get()); });
+}
+
+bool SweepAndPrune::getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const
+{
+    // entries are sorted by left edge, so partners of entry are only those starting before its right edge
+    for (std::size_t entryIndex = 0; entryIndex < entries.size(); entryIndex++)
+    {
+        const auto& entry = entries[entryIndex];
+
+        if (not entry.collider or not entry.collider->isEnabled())
+        {
+            continue;
+        }
+
+        for (auto otherEntryIndex = entryIndex + 1;
+             otherEntryIndex < entries.size() and entries[otherEntryIndex].left <= entry.right;
+             otherEntryIndex++)
+        {
+            const auto& otherEntry = entries[otherEntryIndex];
+
+            if (otherEntry.top > entry.bottom or otherEntry.bottom < entry.top or
+                not(entry.collidingLayersMask & otherEntry.layerMask or
+                    otherEntry.collidingLayersMask & entry.layerMask) or
+                not otherEntry.collider or not otherEntry.collider->isEnabled())
+            {
+                continue;
+            }
+
+            collisionPairs.emplace_back(entry.collider.get(), otherEntry.collider.get());
+        }
+    }
+
+    return true;
+}
+
+void SweepAndPrune::getPossibleStaticCollidersInArea(
+    const utils::FloatRect&, std::vector<components::core::BoxColliderComponent*>&) const
+{
+}
+
+SweepAndPrune::Entry
+SweepAndPrune::createEntry(const std::shared_ptr<components::core::BoxColliderComponent>& collider)
+{
+    const auto collisionBox = collider->getCollisionBox();
+    const auto nextFrameXCollisionBox = collider->getNextFrameXCollisionBox();
+    const auto nextFrameYCollisionBox = collider->getNextFrameYCollisionBox();
+
+    return {collider,
+            components::core::toCollisionLayerMask(collider->getCollisionLayer()),
+            getLayersCollidingWith(collider->getCollisionLayer()),
+            std::min(collisionBox.left, nextFrameXCollisionBox.left),
+            std::max(collisionBox.left, nextFrameXCollisionBox.left) + collisionBox.width,
+            std::min(collisionBox.top, nextFrameYCollisionBox.top),
+            std::max(collisionBox.top, nextFrameYCollisionBox.top) + collisionBox.height};
+}
+
+float SweepAndPrune::getWidth(const Entry& entry)
+{
+    return entry.right - entry.left;
+}
+
+void SweepAndPrune::moveIntoSortedPosition(std::size_t entryIndex)
+{
+    // colliders barely move between frames, so entries are shifted only by a few positions
+    while (entryIndex > 0 and entries[entryIndex - 1].left > entries[entryIndex].left)
+    {
+        swapEntries(entryIndex - 1, entryIndex);
+        entryIndex--;
+    }
+
+    while (entryIndex + 1 < entries.size() and entries[entryIndex + 1].left < entries[entryIndex].left)
+    {
+        swapEntries(entryIndex, entryIndex + 1);
+        entryIndex++;
+    }
+}
+
+void SweepAndPrune::swapEntries(std::size_t firstEntryIndex, std::size_t secondEntryIndex)
+{
+    std::swap(entries[firstEntryIndex], entries[secondEntryIndex]);
+
+    if (const auto& firstCollider = entries[firstEntryIndex].collider)
+    {
+        indicesOfEntries[firstCollider.get()] = firstEntryIndex;
+    }
+
+    if (const auto& secondCollider = entries[secondEntryIndex].collider)
+    {
+        indicesOfEntries[secondCollider.get()] = secondEntryIndex;
+    }
+}
+
+void SweepAndPrune::removeDeadEntries()
+{
+    std::erase_if(entries, [](const Entry& entry) { return not entry.collider; });
+    numberOfDeadEntries = 0;
+
+    for (std::size_t entryIndex = 0; entryIndex < entries.size(); entryIndex++)
+    {
+        indicesOfEntries[entries[entryIndex].collider.get()] = entryIndex;
+    }
+}
+
+template <typename Visitor>
+void SweepAndPrune::visitCollidersOverlappingWithArea(const utils::FloatRect& area,
+                                                      components::core::CollisionLayerMask layerMask,
+                                                      Visitor&& visitor) const
+{
+    const auto areaRight = area.left + area.width;
+    const auto areaBottom = area.top + area.height;
+
+    // no entry starting before this point is wide enough to reach area
+    const auto maxEntryWidth = widthsOfEntries.empty() ? 0.f : *widthsOfEntries.rbegin();
+    const auto firstEntry =
+        std::lower_bound(entries.begin(), entries.end(), area.left - maxEntryWidth,
+                         [](const Entry& entry, float left) { return entry.left < left; });
+
+    for (auto entry = firstEntry; entry != entries.end() and entry->left <= areaRight; entry++)
+    {
+        if (not entry->collider or entry->right < area.left or entry->top > areaBottom or
+            entry->bottom < area.top or not(entry->layerMask & layerMask))
+        {
+            continue;
+        }
+
+        if (entry->collider->isEnabled())
+        {
+            visitor(entry->collider);
+        }
+    }
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <set>
+#include <unordered_map>
+
+#include "Quadtree.h"
+
+namespace physics
+{
+class SweepAndPrune : public Quadtree
+{
+public:
+    explicit SweepAndPrune(const utils::FloatRect& bounds);
+
+    void insertCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void updateCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void removeCollider(const std::shared_ptr<components::core::BoxColliderComponent>&) override;
+    void clearAllColliders() override;
+    const utils::FloatRect& getNodeBounds() const override;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+    getCollidersIntersectingWithAreaFromX(const utils::FloatRect& area) const override;
+    std::vector<std::shared_ptr<components::core::BoxColliderComponent>>
+    getCollidersIntersectingWithAreaFromY(const utils::FloatRect& area) const override;
+    void getCollidersIntersectingWithAreaFromX(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getCollidersIntersectingWithAreaFromY(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+    void getPossibleCollidersInArea(
+        const utils::FloatRect& area, std::vector<components::core::BoxColliderComponent*>& colliders,
+        components::core::CollisionLayerMask layerMask = components::core::allCollisionLayers) const override;
+    bool getPossibleCollisionPairs(std::vector<CollisionPair>& collisionPairs) const override;
+    void getPossibleStaticCollidersInArea(
+        const utils::FloatRect& area,
+        std::vector<components::core::BoxColliderComponent*>& colliders) const override;
+
+private:
+    // extents cover current and next frame collision boxes of collider
+    struct Entry
+    {
+        std::shared_ptr<components::core::BoxColliderComponent> collider;
+        components::core::CollisionLayerMask layerMask;
+        components::core::CollisionLayerMask collidingLayersMask;
+        float left;
+        float right;
+        float top;
+        float bottom;
+    };
+
+    static Entry createEntry(const std::shared_ptr<components::core::BoxColliderComponent>&);
+    static float getWidth(const Entry&);
+    void moveIntoSortedPosition(std::size_t entryIndex);
+    void swapEntries(std::size_t firstEntryIndex, std::size_t secondEntryIndex);
+    void removeDeadEntries();
+    template <typename Visitor>
+    void visitCollidersOverlappingWithArea(const utils::FloatRect& area, components::core::CollisionLayerMask,
+                                           Visitor&& visitor) const;
+
+    utils::FloatRect bounds;
+    std::vector<Entry> entries;
+    std::unordered_map<const components::core::BoxColliderComponent*, std::size_t> indicesOfEntries;
+    // widest entry bounds queries, so widths are kept sorted also when widest collider is removed or shrinks
+    std::multiset<float> widthsOfEntries;
+    // removed entries stay in place without collider and are erased in batches, so removing is not linear
+    std::size_t numberOfDeadEntries;
+};
+}
@@ -0,0 +1,242 @@
+#include "SweepAndPrune.h"
+
+#include "gtest/gtest.h"
+
+#include "RendererPoolMock.h"
+
+using namespace physics;
+using namespace components::core;
+using namespace ::testing;
+
+class SweepAndPruneTest : public Test
+{
+public:
+    const utils::Vector2f size{5, 5};
+    const utils::Vector2f wideSize{40, 5};
+    const utils::Vector2f position1{20, 20};
+    const utils::Vector2f position2{22, 22};
+    const utils::Vector2f position3{60, 20};
+    const utils::Vector2f position4{10, 40};
+    const utils::Vector2f position5{100, 20};
+    const utils::FloatRect bounds{0, 0, 640, 60};
+    const utils::FloatRect area1{18, 18, 5, 5};
+    const utils::FloatRect area2{58, 18, 5, 5};
+    std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<components::core::SharedContext> sharedContext =
+        std::make_shared<components::core::SharedContext>(rendererPool);
+    ComponentOwner componentOwner1{position1, "sweepAndPruneTest1", sharedContext};
+    ComponentOwner componentOwner2{position2, "sweepAndPruneTest2", sharedContext};
+    ComponentOwner componentOwner3{position3, "sweepAndPruneTest3", sharedContext};
+    ComponentOwner componentOwner4{position4, "sweepAndPruneTest4", sharedContext};
+    ComponentOwner componentOwner5{position5, "sweepAndPruneTest5", sharedContext};
+    std::shared_ptr<BoxColliderComponent> boxColliderComponent1 =
+        std::make_shared<BoxColliderComponent>(&componentOwner1, size);
+    std::shared_ptr<BoxColliderComponent> boxColliderComponent2 =
+        std::make_shared<BoxColliderComponent>(&componentOwner2, size);
+    std::shared_ptr<BoxColliderComponent> boxColliderComponent3 =
+        std::make_shared<BoxColliderComponent>(&componentOwner3, size);
+    std::shared_ptr<BoxColliderComponent> boxColliderComponent5 =
+        std::make_shared<BoxColliderComponent>(&componentOwner5, size);
+    std::shared_ptr<BoxColliderComponent> wideBoxColliderComponent =
+        std::make_shared<BoxColliderComponent>(&componentOwner4, wideSize);
+    SweepAndPrune sweepAndPrune{bounds};
+};
+
+TEST_F(SweepAndPruneTest, givenNoColliders_shouldReturnEmptyColliders)
+{
+    const auto collidersIntersectingWithArea = sweepAndPrune.getCollidersIntersectingWithAreaFromX(area1);
+
+    ASSERT_TRUE(collidersIntersectingWithArea.empty());
+}
+
+TEST_F(SweepAndPruneTest, shouldReturnBoundsSetInConstructor)
+{
+    ASSERT_EQ(sweepAndPrune.getNodeBounds(), bounds);
+}
+
+TEST_F(SweepAndPruneTest, insertedColliderIntersectingWithArea_canBeIntersectedWithArea)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithAreaFromX =
+        sweepAndPrune.getCollidersIntersectingWithAreaFromX(area1);
+    const auto collidersIntersectingWithAreaFromY =
+        sweepAndPrune.getCollidersIntersectingWithAreaFromY(area1);
+
+    ASSERT_EQ(collidersIntersectingWithAreaFromX.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithAreaFromX[0], boxColliderComponent1);
+    ASSERT_EQ(collidersIntersectingWithAreaFromY.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithAreaFromY[0], boxColliderComponent1);
+}
+
+TEST_F(SweepAndPruneTest, removedCollider_canNotBeIntersectedWithArea)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+    sweepAndPrune.removeCollider(boxColliderComponent1);
+
+    ASSERT_TRUE(sweepAndPrune.getCollidersIntersectingWithAreaFromX(area1).empty());
+    ASSERT_EQ(sweepAndPrune.getCollidersIntersectingWithAreaFromX(area2).size(), 1u);
+}
+
+TEST_F(SweepAndPruneTest, clearedColliders_shouldReturnEmptyColliders)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+
+    sweepAndPrune.clearAllColliders();
+
+    ASSERT_TRUE(sweepAndPrune.getCollidersIntersectingWithAreaFromX(area1).empty());
+    ASSERT_TRUE(sweepAndPrune.getCollidersIntersectingWithAreaFromX(area2).empty());
+}
+
+TEST_F(SweepAndPruneTest, updatedColliderMovedPastOtherCollider_canBeIntersectedOnlyWithAreaAtNewPosition)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+
+    componentOwner1.transform->setPosition(position3);
+    sweepAndPrune.updateCollider(boxColliderComponent1);
+
+    const auto collidersIntersectingWithOldArea = sweepAndPrune.getCollidersIntersectingWithAreaFromX(area1);
+    const auto collidersIntersectingWithNewArea = sweepAndPrune.getCollidersIntersectingWithAreaFromX(area2);
+    ASSERT_EQ(collidersIntersectingWithOldArea.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithOldArea[0], boxColliderComponent2);
+    ASSERT_EQ(collidersIntersectingWithNewArea.size(), 1u);
+    ASSERT_EQ(collidersIntersectingWithNewArea[0], boxColliderComponent1);
+}
+
+TEST_F(SweepAndPruneTest, wideColliderStartingLongBeforeArea_canBeIntersectedWithArea)
+{
+    sweepAndPrune.insertCollider(wideBoxColliderComponent);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    sweepAndPrune.getPossibleCollidersInArea(utils::FloatRect{45, 38, 3, 3}, possibleColliders);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{wideBoxColliderComponent.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(SweepAndPruneTest, disabledCollider_shouldNotBeReturned)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    boxColliderComponent1->disable();
+
+    ASSERT_TRUE(sweepAndPrune.getCollidersIntersectingWithAreaFromX(area1).empty());
+}
+
+TEST_F(SweepAndPruneTest, afterWideColliderWasRemoved_narrowCollidersShouldStillBeReturned)
+{
+    sweepAndPrune.insertCollider(wideBoxColliderComponent);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+    sweepAndPrune.removeCollider(wideBoxColliderComponent);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    sweepAndPrune.getPossibleCollidersInArea(utils::FloatRect{0, 0, 100, 60}, possibleColliders);
+
+    ASSERT_THAT(possibleColliders,
+                UnorderedElementsAre(boxColliderComponent1.get(), boxColliderComponent3.get()));
+}
+
+TEST_F(SweepAndPruneTest, wideColliderMovedFarAway_canBeIntersectedWithAreaAtItsNewEnd)
+{
+    sweepAndPrune.insertCollider(wideBoxColliderComponent);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    componentOwner4.transform->setPosition(utils::Vector2f{200, 40});
+    sweepAndPrune.updateCollider(wideBoxColliderComponent);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    sweepAndPrune.getPossibleCollidersInArea(utils::FloatRect{235, 38, 3, 3}, possibleColliders);
+
+    const std::vector<BoxColliderComponent*> expectedColliders{wideBoxColliderComponent.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(SweepAndPruneTest, possibleCollidersInArea_shouldSkipCollidersFromLayersOutsideOfMask)
+{
+    boxColliderComponent2->setCollisionLayer(CollisionLayer::Player);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    sweepAndPrune.getPossibleCollidersInArea(area1, possibleColliders,
+                                             toCollisionLayerMask(CollisionLayer::Player));
+
+    const std::vector<BoxColliderComponent*> expectedColliders{boxColliderComponent2.get()};
+    ASSERT_EQ(possibleColliders, expectedColliders);
+}
+
+TEST_F(SweepAndPruneTest, possibleCollisionPairs_shouldContainOnlyOverlappingColliders)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    std::vector<Quadtree::CollisionPair> collisionPairs;
+
+    const auto collisionPairsFound = sweepAndPrune.getPossibleCollisionPairs(collisionPairs);
+
+    const std::vector<Quadtree::CollisionPair> expectedCollisionPairs{
+        {boxColliderComponent1.get(), boxColliderComponent2.get()}};
+    ASSERT_TRUE(collisionPairsFound);
+    ASSERT_EQ(collisionPairs, expectedCollisionPairs);
+}
+
+TEST_F(SweepAndPruneTest, possibleCollisionPairs_shouldSkipCollidersWhoseLayersDoNotCollide)
+{
+    boxColliderComponent2->setCollisionLayer(CollisionLayer::Tile);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+    std::vector<Quadtree::CollisionPair> collisionPairs;
+
+    sweepAndPrune.getPossibleCollisionPairs(collisionPairs);
+
+    ASSERT_TRUE(collisionPairs.empty());
+}
+
+TEST_F(SweepAndPruneTest, removedColliderWaitingForCompaction_shouldBeSkippedByQueriesAndPairs)
+{
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+    sweepAndPrune.insertCollider(wideBoxColliderComponent);
+    sweepAndPrune.insertCollider(boxColliderComponent5);
+    sweepAndPrune.removeCollider(boxColliderComponent2);
+    componentOwner3.transform->setPosition(utils::Vector2f{21, 21});
+    sweepAndPrune.updateCollider(boxColliderComponent3);
+    std::vector<BoxColliderComponent*> possibleColliders;
+    std::vector<Quadtree::CollisionPair> collisionPairs;
+
+    sweepAndPrune.getPossibleCollidersInArea(area1, possibleColliders);
+    sweepAndPrune.getPossibleCollisionPairs(collisionPairs);
+
+    ASSERT_THAT(possibleColliders,
+                UnorderedElementsAre(boxColliderComponent1.get(), boxColliderComponent3.get()));
+    const std::vector<Quadtree::CollisionPair> expectedCollisionPairs{
+        {boxColliderComponent1.get(), boxColliderComponent3.get()}};
+    ASSERT_EQ(collisionPairs, expectedCollisionPairs);
+}
+
+TEST_F(SweepAndPruneTest, afterRemovedCollidersWereCompacted_remainingCollidersShouldStillBeUpdated)
+{
+    sweepAndPrune.insertCollider(wideBoxColliderComponent);
+    sweepAndPrune.insertCollider(boxColliderComponent1);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+    sweepAndPrune.insertCollider(boxColliderComponent3);
+    sweepAndPrune.insertCollider(boxColliderComponent5);
+    sweepAndPrune.removeCollider(wideBoxColliderComponent);
+    sweepAndPrune.removeCollider(boxColliderComponent2);
+    componentOwner5.transform->setPosition(utils::Vector2f{19, 19});
+    sweepAndPrune.updateCollider(boxColliderComponent5);
+    sweepAndPrune.insertCollider(boxColliderComponent2);
+    std::vector<BoxColliderComponent*> possibleColliders;
+
+    sweepAndPrune.getPossibleCollidersInArea(area1, possibleColliders);
+
+    ASSERT_THAT(possibleColliders, UnorderedElementsAre(boxColliderComponent1.get(),
+                                                        boxColliderComponent2.get(),
+                                                        boxColliderComponent5.get()));
+}
\ No newline at end of file
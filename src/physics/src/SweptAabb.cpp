@@ -0,0 +1,73 @@
+#include "SweptAabb.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace physics
+{
+namespace
+{
+const auto infinity = std::numeric_limits<float>::infinity();
+
+struct AxisInterval
+{
+    float entryTime;
+    float exitTime;
+};
+
+// times at which moving interval starts and stops overlapping obstacle interval, touching is not overlapping
+std::optional<AxisInterval> getOverlapTimes(float start, float size, float displacement, float obstacleStart,
+                                            float obstacleSize)
+{
+    const auto distanceToEntry = obstacleStart - (start + size);
+    const auto distanceToExit = obstacleStart + obstacleSize - start;
+
+    if (displacement == 0)
+    {
+        if (distanceToEntry < 0 and distanceToExit > 0)
+        {
+            return AxisInterval{-infinity, infinity};
+        }
+
+        return std::nullopt;
+    }
+
+    if (displacement > 0)
+    {
+        return AxisInterval{distanceToEntry / displacement, distanceToExit / displacement};
+    }
+
+    return AxisInterval{distanceToExit / displacement, distanceToEntry / displacement};
+}
+}
+
+std::optional<TimeOfImpact> getTimeOfImpact(const utils::FloatRect& box, const utils::Vector2f& displacement,
+                                            const utils::FloatRect& obstacle)
+{
+    const auto intervalX =
+        getOverlapTimes(box.left, box.width, displacement.x, obstacle.left, obstacle.width);
+    const auto intervalY =
+        getOverlapTimes(box.top, box.height, displacement.y, obstacle.top, obstacle.height);
+
+    if (not intervalX or not intervalY)
+    {
+        return std::nullopt;
+    }
+
+    const auto entryTime = std::max(intervalX->entryTime, intervalY->entryTime);
+    const auto exitTime = std::min(intervalX->exitTime, intervalY->exitTime);
+
+    if (entryTime >= exitTime or entryTime < 0 or entryTime > 1)
+    {
+        return std::nullopt;
+    }
+
+    if (intervalX->entryTime >= intervalY->entryTime)
+    {
+        return TimeOfImpact{entryTime, {displacement.x > 0 ? -1.f : 1.f, 0}};
+    }
+
+    return TimeOfImpact{entryTime, {0, displacement.y > 0 ? -1.f : 1.f}};
+}
+
+}
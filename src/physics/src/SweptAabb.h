@@ -0,0 +1,13 @@
+#pragma once
+
+#include <optional>
+
+#include "Rect.h"
+#include "TimeOfImpact.h"
+
+namespace physics
+{
+// returns first touch of box moved by displacement with obstacle, boxes overlapping from start are not hit
+std::optional<TimeOfImpact> getTimeOfImpact(const utils::FloatRect& box, const utils::Vector2f& displacement,
+                                            const utils::FloatRect& obstacle);
+}
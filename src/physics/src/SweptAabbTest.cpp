@@ -0,0 +1,74 @@
+#include "SweptAabb.h"
+
+#include "gtest/gtest.h"
+
+using namespace physics;
+using namespace ::testing;
+
+class SweptAabbTest : public Test
+{
+public:
+    const utils::FloatRect box{0, 0, 2, 2};
+    const utils::FloatRect obstacle{10, 0, 4, 4};
+};
+
+TEST_F(SweptAabbTest, boxMovingThroughObstacle_shouldHitItAtEntryWithNormalAgainstMovement)
+{
+    const auto timeOfImpact = getTimeOfImpact(box, {20, 0}, obstacle);
+
+    ASSERT_TRUE(timeOfImpact);
+    ASSERT_FLOAT_EQ(timeOfImpact->time, 0.4f);
+    ASSERT_EQ(timeOfImpact->normal, utils::Vector2f(-1, 0));
+}
+
+TEST_F(SweptAabbTest, boxMovingLeftIntoObstacle_shouldHitItWithNormalPointingRight)
+{
+    const utils::FloatRect boxOnRight{20, 1, 2, 2};
+
+    const auto timeOfImpact = getTimeOfImpact(boxOnRight, {-10, 0}, obstacle);
+
+    ASSERT_TRUE(timeOfImpact);
+    ASSERT_FLOAT_EQ(timeOfImpact->time, 0.6f);
+    ASSERT_EQ(timeOfImpact->normal, utils::Vector2f(1, 0));
+}
+
+TEST_F(SweptAabbTest, boxFallingOntoObstacle_shouldHitItWithNormalPointingUp)
+{
+    const utils::FloatRect boxAbove{11, -10, 2, 2};
+
+    const auto timeOfImpact = getTimeOfImpact(boxAbove, {0, 16}, obstacle);
+
+    ASSERT_TRUE(timeOfImpact);
+    ASSERT_FLOAT_EQ(timeOfImpact->time, 0.5f);
+    ASSERT_EQ(timeOfImpact->normal, utils::Vector2f(0, -1));
+}
+
+TEST_F(SweptAabbTest, boxStoppingBeforeObstacle_shouldNotHitIt)
+{
+    ASSERT_FALSE(getTimeOfImpact(box, {7, 0}, obstacle));
+}
+
+TEST_F(SweptAabbTest, boxMovingPastObstacle_shouldNotHitIt)
+{
+    const utils::FloatRect boxBelow{0, 4, 2, 2};
+
+    ASSERT_FALSE(getTimeOfImpact(boxBelow, {20, 0}, obstacle));
+}
+
+TEST_F(SweptAabbTest, boxOverlappingObstacleFromStart_shouldNotHitIt)
+{
+    const utils::FloatRect boxInsideObstacle{11, 1, 2, 2};
+
+    ASSERT_FALSE(getTimeOfImpact(boxInsideObstacle, {20, 0}, obstacle));
+}
+
+TEST_F(SweptAabbTest, diagonallyMovingBox_shouldHitObstacleOnAxisEnteredLast)
+{
+    const utils::FloatRect boxAboveLeft{0, -6, 2, 2};
+
+    const auto timeOfImpact = getTimeOfImpact(boxAboveLeft, {12, 12}, obstacle);
+
+    ASSERT_TRUE(timeOfImpact);
+    ASSERT_FLOAT_EQ(timeOfImpact->time, 2.f / 3.f);
+    ASSERT_EQ(timeOfImpact->normal, utils::Vector2f(-1, 0));
+}
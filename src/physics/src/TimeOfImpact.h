@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace physics
+{
+struct TimeOfImpact
+{
+    // fraction of displacement after which moving box touches obstacle
+    float time;
+    utils::Vector2f normal;
+};
+}
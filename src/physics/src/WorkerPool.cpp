@@ -0,0 +1,130 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace physics
+{
+
+WorkerPool::WorkerPool(std::size_t numberOfThreads)
+    : currentTask{nullptr}, numberOfTasks{0}, nextTaskIndex{0}, numberOfFinishedTasks{0}, generation{0},
+      stopping{false}
+{
+    for (std::size_t threadIndex = 1; threadIndex < std::max<std::size_t>(numberOfThreads, 1); threadIndex++)
+    {
+        workers.emplace_back([this] { work(); });
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+
+    tasksAvailable.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(std::size_t numberOfTasksToRun, const std::function<void(std::size_t)>& task)
+{
+    if (workers.empty() or numberOfTasksToRun == 1)
+    {
+        for (std::size_t taskIndex = 0; taskIndex < numberOfTasksToRun; taskIndex++)
+        {
+            task(taskIndex);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        currentTask = &task;
+        numberOfTasks = numberOfTasksToRun;
+        nextTaskIndex = 0;
+        numberOfFinishedTasks = 0;
+        generation++;
+    }
+
+    tasksAvailable.notify_all();
+    runTasks();
+
+    std::unique_lock<std::mutex> lock{mutex};
+    tasksFinished.wait(lock, [this] { return numberOfFinishedTasks == numberOfTasks; });
+    currentTask = nullptr;
+
+    if (taskException)
+    {
+        std::rethrow_exception(std::exchange(taskException, nullptr));
+    }
+}
+
+std::size_t WorkerPool::getNumberOfThreads() const
+{
+    return workers.size() + 1;
+}
+
+void WorkerPool::work()
+{
+    std::size_t lastGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            tasksAvailable.wait(lock, [&] { return stopping or generation != lastGeneration; });
+
+            if (stopping)
+            {
+                return;
+            }
+
+            lastGeneration = generation;
+        }
+
+        runTasks();
+    }
+}
+
+void WorkerPool::runTasks()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+
+    while (currentTask and nextTaskIndex < numberOfTasks)
+    {
+        const auto taskIndex = nextTaskIndex++;
+        const auto& task = *currentTask;
+
+        lock.unlock();
+        std::exception_ptr exception;
+        try
+        {
+            task(taskIndex);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+        lock.lock();
+
+        if (exception and not taskException)
+        {
+            taskException = exception;
+            numberOfFinishedTasks += numberOfTasks - nextTaskIndex;
+            nextTaskIndex = numberOfTasks;
+        }
+
+        if (++numberOfFinishedTasks == numberOfTasks)
+        {
+            tasksFinished.notify_all();
+        }
+    }
+}
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace physics
+{
+// threads are started once and reused, calling thread takes part in running tasks as well
+class WorkerPool
+{
+public:
+    explicit WorkerPool(std::size_t numberOfThreads);
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // returns after task was called with every index from 0 to numberOfTasks - 1,
+    // first exception thrown by task is rethrown here and tasks not started yet are skipped
+    void run(std::size_t numberOfTasks, const std::function<void(std::size_t taskIndex)>& task);
+    std::size_t getNumberOfThreads() const;
+
+private:
+    void work();
+    void runTasks();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable tasksAvailable;
+    std::condition_variable tasksFinished;
+    const std::function<void(std::size_t)>* currentTask;
+    std::size_t numberOfTasks;
+    std::size_t nextTaskIndex;
+    std::size_t numberOfFinishedTasks;
+    std::size_t generation;
+    std::exception_ptr taskException;
+    bool stopping;
+};
+}
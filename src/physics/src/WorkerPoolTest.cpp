@@ -0,0 +1,90 @@
+#include "WorkerPool.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+using namespace physics;
+using namespace ::testing;
+
+class WorkerPoolTest : public Test
+{
+public:
+    const std::size_t numberOfTasks{100};
+};
+
+TEST_F(WorkerPoolTest, shouldCountCallingThreadAsOneOfThreads)
+{
+    WorkerPool workerPool{4};
+
+    ASSERT_EQ(workerPool.getNumberOfThreads(), 4u);
+}
+
+TEST_F(WorkerPoolTest, givenZeroThreads_shouldRunTasksOnCallingThread)
+{
+    WorkerPool workerPool{0};
+    const auto callingThreadId = std::this_thread::get_id();
+    std::vector<std::thread::id> threadIdsOfTasks(numberOfTasks);
+
+    workerPool.run(numberOfTasks,
+                   [&](std::size_t taskIndex) { threadIdsOfTasks[taskIndex] = std::this_thread::get_id(); });
+
+    ASSERT_EQ(workerPool.getNumberOfThreads(), 1u);
+    ASSERT_EQ(std::count(threadIdsOfTasks.begin(), threadIdsOfTasks.end(), callingThreadId), 100);
+}
+
+TEST_F(WorkerPoolTest, shouldRunEveryTaskExactlyOnce)
+{
+    WorkerPool workerPool{4};
+    std::vector<std::atomic<int>> numbersOfTaskRuns(numberOfTasks);
+
+    workerPool.run(numberOfTasks, [&](std::size_t taskIndex) { numbersOfTaskRuns[taskIndex]++; });
+
+    for (const auto& numberOfTaskRuns : numbersOfTaskRuns)
+    {
+        ASSERT_EQ(numberOfTaskRuns, 1);
+    }
+}
+
+TEST_F(WorkerPoolTest, shouldRunTasksOfConsecutiveRuns)
+{
+    WorkerPool workerPool{4};
+    std::atomic<std::size_t> sumOfTaskIndices{0};
+
+    for (int run = 0; run < 50; run++)
+    {
+        workerPool.run(numberOfTasks, [&](std::size_t taskIndex) { sumOfTaskIndices += taskIndex; });
+    }
+
+    ASSERT_EQ(sumOfTaskIndices, 50 * numberOfTasks * (numberOfTasks - 1) / 2);
+}
+
+
+TEST_F(WorkerPoolTest, givenThrowingTask_shouldRethrowExceptionFromRun)
+{
+    WorkerPool workerPool{4};
+
+    ASSERT_THROW(workerPool.run(numberOfTasks,
+                                [](std::size_t taskIndex)
+                                {
+                                    if (taskIndex == 3)
+                                    {
+                                        throw std::runtime_error{"task failed"};
+                                    }
+                                }),
+                 std::runtime_error);
+}
+
+TEST_F(WorkerPoolTest, givenThrowingTaskInPreviousRun_shouldRunEveryTaskOfNextRun)
+{
+    WorkerPool workerPool{4};
+    std::atomic<std::size_t> numberOfTaskRuns{0};
+
+    ASSERT_THROW(workerPool.run(numberOfTasks,
+                                [](std::size_t) { throw std::runtime_error{"task failed"}; }),
+                 std::runtime_error);
+    workerPool.run(numberOfTasks, [&](std::size_t) { numberOfTaskRuns++; });
+
+    ASSERT_EQ(numberOfTaskRuns, numberOfTasks);
+}
\ No newline at end of file
@@ -9,6 +9,11 @@ RandomNumberMersenneTwisterGenerator::RandomNumberMersenneTwisterGenerator()
 {
 }
 
+RandomNumberMersenneTwisterGenerator::RandomNumberMersenneTwisterGenerator(unsigned seed)
+    : pseudoRandomGenerator{seed}
+{
+}
+
 int RandomNumberMersenneTwisterGenerator::generate(int rangeStart, int rangeEnd)
 {
     if (rangeStart > rangeEnd)
@@ -10,6 +10,7 @@ class RandomNumberMersenneTwisterGenerator : public RandomNumberGenerator
 {
 public:
     RandomNumberMersenneTwisterGenerator();
+    explicit RandomNumberMersenneTwisterGenerator(unsigned seed);
 
     int generate(int rangeStart, int rangeEnd) override;
 
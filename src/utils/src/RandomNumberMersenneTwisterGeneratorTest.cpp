@@ -36,4 +36,15 @@ TEST_F(RandomNumberMersenneTwisterGeneratorTest,
 
     ASSERT_TRUE(actualRandomNumber >= rangeStart);
     ASSERT_TRUE(actualRandomNumber <= rangeEnd);
-}
\ No newline at end of file
+}
+TEST_F(RandomNumberMersenneTwisterGeneratorTest, generatorsWithSameSeed_shouldGenerateSameNumbers)
+{
+    RandomNumberMersenneTwisterGenerator seededRandomGenerator1{42};
+    RandomNumberMersenneTwisterGenerator seededRandomGenerator2{42};
+
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_EQ(seededRandomGenerator1.generate(rangeStart, rangeEnd),
+                  seededRandomGenerator2.generate(rangeStart, rangeEnd));
+    }
+}
@@ -0,0 +1,16 @@
+#include "SimulationClock.h"
+
+namespace utils
+{
+
+void SimulationClock::advance(const DeltaTime& deltaTime)
+{
+    elapsedSeconds += deltaTime.count();
+}
+
+float SimulationClock::getElapsedSeconds() const
+{
+    return static_cast<float>(elapsedSeconds);
+}
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "DeltaTime.h"
+
+namespace utils
+{
+class SimulationClock
+{
+public:
+    void advance(const DeltaTime&);
+    float getElapsedSeconds() const;
+
+private:
+    double elapsedSeconds{0};
+};
+}
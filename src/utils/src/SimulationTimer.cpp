@@ -0,0 +1,23 @@
+#include "SimulationTimer.h"
+
+#include <utility>
+
+namespace utils
+{
+
+SimulationTimer::SimulationTimer(std::shared_ptr<const SimulationClock> clockInit)
+    : clock{std::move(clockInit)}, startSeconds{clock->getElapsedSeconds()}
+{
+}
+
+void SimulationTimer::restart()
+{
+    startSeconds = clock->getElapsedSeconds();
+}
+
+float SimulationTimer::getElapsedSeconds() const
+{
+    return clock->getElapsedSeconds() - startSeconds;
+}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+
+#include "SimulationClock.h"
+#include "Timer.h"
+
+namespace utils
+{
+class SimulationTimer : public Timer
+{
+public:
+    explicit SimulationTimer(std::shared_ptr<const SimulationClock>);
+
+    void restart() override;
+    float getElapsedSeconds() const override;
+
+private:
+    std::shared_ptr<const SimulationClock> clock;
+    float startSeconds;
+};
+}
@@ -0,0 +1,32 @@
+#include "SimulationTimer.h"
+
+#include "gtest/gtest.h"
+
+using namespace utils;
+
+class SimulationTimerTest : public testing::Test
+{
+public:
+    std::shared_ptr<SimulationClock> clock = std::make_shared<SimulationClock>();
+};
+
+TEST_F(SimulationTimerTest, getElapsedSeconds_shouldCountOnlyTimeAdvancedByClock)
+{
+    clock->advance(DeltaTime{0.5f});
+    SimulationTimer timer{clock};
+
+    clock->advance(DeltaTime{0.25f});
+    clock->advance(DeltaTime{0.25f});
+
+    ASSERT_FLOAT_EQ(timer.getElapsedSeconds(), 0.5f);
+}
+
+TEST_F(SimulationTimerTest, restart)
+{
+    SimulationTimer timer{clock};
+    clock->advance(DeltaTime{0.5f});
+
+    timer.restart();
+
+    ASSERT_FLOAT_EQ(timer.getElapsedSeconds(), 0.f);
+}
@@ -1,12 +1,27 @@
 #include "TimerFactory.h"
 
 #include "DefaultTimer.h"
+#include "SimulationTimer.h"
 
 namespace utils
 {
+namespace
+{
+std::shared_ptr<const SimulationClock> simulationClock;
+}
 
 std::unique_ptr<Timer> TimerFactory::createTimer()
 {
+    if (simulationClock)
+    {
+        return std::make_unique<SimulationTimer>(simulationClock);
+    }
+
     return std::make_unique<DefaultTimer>();
 }
-}
\ No newline at end of file
+
+void TimerFactory::useSimulationClock(std::shared_ptr<const SimulationClock> clock)
+{
+    simulationClock = std::move(clock);
+}
+}
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "SimulationClock.h"
 #include "Timer.h"
 
 namespace utils
@@ -10,5 +11,6 @@ class TimerFactory
 {
 public:
     static std::unique_ptr<Timer> createTimer();
+    static void useSimulationClock(std::shared_ptr<const SimulationClock>);
 };
-}
\ No newline at end of file
+}
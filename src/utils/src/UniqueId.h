@@ -1,8 +1,8 @@
 #pragma once
 
-#include "boost/uuid/uuid.hpp"
+#include <cstdint>
 
 namespace utils
 {
-using UniqueId = boost::uuids::uuid;
+using UniqueId = std::uint64_t;
 }
\ No newline at end of file
@@ -1,11 +1,13 @@
 #include "UniqueIdGenerator.h"
 
-#include <boost/uuid/uuid_generators.hpp>
+#include <atomic>
 
 namespace utils
 {
 UniqueId UniqueIdGenerator::generateId()
 {
-    return boost::uuids::random_generator()();
+    static std::atomic<UniqueId> nextId{1};
+
+    return nextId++;
 }
 }
\ No newline at end of file
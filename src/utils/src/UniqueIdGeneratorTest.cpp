@@ -0,0 +1,14 @@
+#include "UniqueIdGenerator.h"
+
+#include "gtest/gtest.h"
+
+using namespace utils;
+using namespace ::testing;
+
+TEST(UniqueIdGeneratorTest, generatedIds_shouldIncrease)
+{
+    const auto id1 = UniqueIdGenerator::generateId();
+    const auto id2 = UniqueIdGenerator::generateId();
+
+    ASSERT_LT(id1, id2);
+}
\ No newline at end of file
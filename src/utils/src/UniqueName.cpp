@@ -7,43 +7,49 @@ namespace utils
 {
 std::unordered_set<std::string> UniqueName::uniqueNames{};
 
-UniqueName::UniqueName(std::string nameInit) : name{std::move(nameInit)}
+UniqueName::UniqueName(std::string nameInit)
+    : id{UniqueIdGenerator::generateId()}, isGenerated{false}, name{std::move(nameInit)}
 {
-    if (uniqueNames.count(name))
+    registerName();
+}
+
+UniqueName::UniqueName() : id{UniqueIdGenerator::generateId()}, isGenerated{true} {}
+
+UniqueName::~UniqueName()
+{
+    if (not isGenerated)
     {
-        throw exceptions::NameIsNotUnique{"'" + name + "' is already used in program"};
+        uniqueNames.erase(name);
     }
-
-    uniqueNames.insert(name);
 }
 
-UniqueName::UniqueName() : name{getIdFromGenerator()}
+const std::string& UniqueName::getName() const
 {
-    if (uniqueNames.count(name))
+    if (isGenerated and name.empty())
     {
-        throw exceptions::NameIsNotUnique{name + " is already used in program"};
+        name = "#" + std::to_string(id);
     }
 
-    uniqueNames.insert(name);
+    return name;
 }
 
-UniqueName::~UniqueName()
+UniqueId UniqueName::getId() const
 {
-    uniqueNames.erase(name);
+    return id;
 }
 
-std::string UniqueName::getName() const
-{
-    return name;
-}
-std::string UniqueName::getIdFromGenerator()
+void UniqueName::registerName()
 {
-    std::string uniqueId;
-    for (const auto& dataEntry : UniqueIdGenerator::generateId().data)
+    // '#' prefix is reserved for generated names, so they never collide with names given explicitly
+    if (name.starts_with('#'))
     {
-        uniqueId += std::to_string(dataEntry);
+        throw exceptions::NameIsNotUnique{"'" + name + "' is reserved for generated names"};
+    }
+
+    if (not uniqueNames.insert(name).second)
+    {
+        throw exceptions::NameIsNotUnique{"'" + name + "' is already used in program"};
     }
-    return uniqueId;
 }
 
 }
@@ -3,8 +3,11 @@
 #include <string>
 #include <unordered_set>
 
+#include "UniqueId.h"
+
 namespace utils
 {
+// generated names are identified by id alone, their "#<id>" text is formatted only when requested
 class UniqueName
 {
 public:
@@ -15,12 +18,15 @@ public:
     UniqueName(const UniqueName&) = delete;
     UniqueName& operator=(const UniqueName&) = delete;
 
-    std::string getName() const;
+    const std::string& getName() const;
+    UniqueId getId() const;
 
 private:
-    std::string getIdFromGenerator();
+    void registerName();
 
-    std::string name;
+    UniqueId id;
+    bool isGenerated;
+    mutable std::string name;
     static std::unordered_set<std::string> uniqueNames;
 };
 }
\ No newline at end of file
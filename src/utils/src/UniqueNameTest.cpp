@@ -26,4 +26,34 @@ TEST(UniqueNameTest, createWithDefaultConstructor_shouldGenerateId)
     const auto name = UniqueName{};
 
     ASSERT_FALSE(name.getName().empty());
+}
+
+TEST(UniqueNameTest, namesCreatedWithDefaultConstructor_shouldDiffer)
+{
+    const auto name1 = UniqueName{};
+    const auto name2 = UniqueName{};
+
+    ASSERT_NE(name1.getName(), name2.getName());
+    ASSERT_NE(name1.getId(), name2.getId());
+}
+
+TEST(UniqueNameTest, generatedName_shouldNotCollideWithNameOfSameNumber)
+{
+    const auto generatedName = UniqueName{};
+
+    ASSERT_NO_THROW(UniqueName{std::to_string(generatedName.getId())});
+}
+
+TEST(UniqueNameTest, generatedName_shouldBeFormattedFromId)
+{
+    const auto generatedName = UniqueName{};
+
+    ASSERT_EQ(generatedName.getName(), "#" + std::to_string(generatedName.getId()));
+}
+
+TEST(UniqueNameTest, nameWithPrefixOfGeneratedNames_shouldThrowNameIsNotUnique)
+{
+    const auto generatedName = UniqueName{};
+
+    ASSERT_THROW(UniqueName{generatedName.getName()}, exceptions::NameIsNotUnique);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "DefaultWindowFactory.h"
 
 #include "DefaultWindowObservationHandler.h"
+#include "HeadlessWindow.h"
 #include "WindowSfml.h"
 
 namespace window
@@ -12,4 +13,9 @@ std::unique_ptr<Window> DefaultWindowFactory::createWindow(const utils::Vector2u
     return std::make_unique<WindowSfml>(windowSize, title,
                                         std::make_unique<DefaultWindowObservationHandler>());
 }
+
+std::unique_ptr<Window> DefaultWindowFactory::createHeadlessWindow(const utils::Vector2u& windowSize) const
+{
+    return std::make_unique<HeadlessWindow>(windowSize, std::make_unique<DefaultWindowObservationHandler>());
+}
 }
\ No newline at end of file
@@ -11,5 +11,6 @@ class DefaultWindowFactory : public WindowFactory
 public:
     std::unique_ptr<Window> createWindow(const utils::Vector2u& windowSize,
                                          const std::string& title) const override;
+    std::unique_ptr<Window> createHeadlessWindow(const utils::Vector2u& windowSize) const override;
 };
 }
@@ -0,0 +1,116 @@
+#include "HeadlessWindow.h"
+
+#include <utility>
+
+#include "SupportedFrameLimitsRetriever.h"
+
+namespace window
+{
+HeadlessWindow::HeadlessWindow(const utils::Vector2u& windowSize,
+                               std::unique_ptr<WindowObservationHandler> observationHandlerInit)
+    : windowSettings{DisplayMode::Window, Resolution{windowSize.x, windowSize.y}, true, 120},
+      observationHandler{std::move(observationHandlerInit)},
+      open{true}
+{
+}
+
+bool HeadlessWindow::isOpen() const
+{
+    return open;
+}
+
+void HeadlessWindow::display() {}
+
+void HeadlessWindow::update() {}
+
+void HeadlessWindow::close()
+{
+    open = false;
+}
+
+void HeadlessWindow::setView(const sf::View&) {}
+
+bool HeadlessWindow::pollEvent(sf::Event&) const
+{
+    return false;
+}
+
+utils::Vector2f HeadlessWindow::getMousePosition(bool) const
+{
+    return {0, 0};
+}
+
+void HeadlessWindow::registerObserver(WindowObserver* observer)
+{
+    observationHandler->registerObserver(observer);
+}
+
+void HeadlessWindow::removeObserver(WindowObserver* observer)
+{
+    observationHandler->removeObserver(observer);
+}
+
+void HeadlessWindow::notifyObservers()
+{
+    observationHandler->notifyObservers({windowSettings.resolution.width, windowSettings.resolution.height});
+}
+
+WindowSettings HeadlessWindow::getWindowSettings() const
+{
+    return windowSettings;
+}
+
+bool HeadlessWindow::setDisplayMode(DisplayMode displayMode)
+{
+    if (displayMode != windowSettings.displayMode)
+    {
+        windowSettings.displayMode = displayMode;
+        notifyObservers();
+        return true;
+    }
+    return false;
+}
+
+bool HeadlessWindow::setVerticalSync(bool vsyncEnabled)
+{
+    if (vsyncEnabled != windowSettings.vsync)
+    {
+        windowSettings.vsync = vsyncEnabled;
+        return true;
+    }
+    return false;
+}
+
+bool HeadlessWindow::setFramerateLimit(unsigned int frameLimit)
+{
+    if (frameLimit != windowSettings.frameLimit)
+    {
+        windowSettings.frameLimit = frameLimit;
+        return true;
+    }
+    return false;
+}
+
+bool HeadlessWindow::setResolution(const Resolution& resolution)
+{
+    if (resolution != windowSettings.resolution)
+    {
+        windowSettings.resolution = resolution;
+        notifyObservers();
+        return true;
+    }
+    return false;
+}
+
+// there is no display to query, so only current resolution is supported
+std::vector<Resolution> HeadlessWindow::getSupportedResolutions() const
+{
+    return {windowSettings.resolution};
+}
+
+std::vector<unsigned int> HeadlessWindow::getSupportedFrameLimits() const
+{
+    return SupportedFrameLimitsRetriever::retrieveSupportedFrameLimits();
+}
+
+}
\ No newline at end of file
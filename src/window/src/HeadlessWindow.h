@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+
+#include "Vector.h"
+#include "Window.h"
+#include "WindowObservationHandler.h"
+#include "WindowSettings.h"
+
+namespace window
+{
+// window without operating system window, used to run game without display
+class HeadlessWindow : public Window
+{
+public:
+    HeadlessWindow(const utils::Vector2u& windowSize, std::unique_ptr<WindowObservationHandler>);
+
+    bool isOpen() const override;
+    void display() override;
+    void update() override;
+    void close() override;
+    void setView(const sf::View&) override;
+    bool pollEvent(sf::Event& event) const override;
+    utils::Vector2f getMousePosition(bool = false) const override;
+    WindowSettings getWindowSettings() const override;
+    bool setDisplayMode(DisplayMode) override;
+    bool setVerticalSync(bool vsyncEnabled) override;
+    bool setFramerateLimit(unsigned int frameLimit) override;
+    bool setResolution(const Resolution&) override;
+    std::vector<Resolution> getSupportedResolutions() const override;
+    std::vector<unsigned int> getSupportedFrameLimits() const override;
+    void registerObserver(WindowObserver*) override;
+    void removeObserver(WindowObserver*) override;
+
+private:
+    void notifyObservers() override;
+
+    WindowSettings windowSettings;
+    std::unique_ptr<WindowObservationHandler> observationHandler;
+    bool open;
+};
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "HeadlessWindow.h"
+
+#include <SFML/Window/Event.hpp>
+
+#include "gtest/gtest.h"
+
+#include "WindowObservationHandlerMock.h"
+
+using namespace ::testing;
+using namespace window;
+
+namespace
+{
+const utils::Vector2u windowSize{800, 600};
+const Resolution initialResolution{windowSize.x, windowSize.y};
+const Resolution changedResolution{1000, 600};
+const WindowSettings initialWindowSettings{DisplayMode::Window, initialResolution, true, 120};
+}
+
+class HeadlessWindowTest : public Test
+{
+public:
+    std::unique_ptr<WindowObservationHandlerMock> observationHandlerInit =
+        std::make_unique<StrictMock<WindowObservationHandlerMock>>();
+    WindowObservationHandlerMock* observationHandler = observationHandlerInit.get();
+    HeadlessWindow window{windowSize, std::move(observationHandlerInit)};
+};
+
+TEST_F(HeadlessWindowTest, getWindowSettings_shouldReturnSettingsOfWindowSize)
+{
+    ASSERT_EQ(window.getWindowSettings(), initialWindowSettings);
+}
+
+TEST_F(HeadlessWindowTest, shouldBeOpenUntilClosed)
+{
+    ASSERT_TRUE(window.isOpen());
+
+    window.close();
+
+    ASSERT_FALSE(window.isOpen());
+}
+
+TEST_F(HeadlessWindowTest, pollEvent_shouldNotReturnAnyEvent)
+{
+    sf::Event event{};
+
+    ASSERT_FALSE(window.pollEvent(event));
+}
+
+TEST_F(HeadlessWindowTest, givenDifferentResolution_shouldSetResolutionAndNotifyObservers)
+{
+    EXPECT_CALL(*observationHandler,
+                notifyObservers(utils::Vector2u{changedResolution.width, changedResolution.height}));
+
+    ASSERT_TRUE(window.setResolution(changedResolution));
+    ASSERT_EQ(window.getWindowSettings().resolution, changedResolution);
+}
+
+TEST_F(HeadlessWindowTest, getSupportedResolutions_shouldReturnOnlyCurrentResolution)
+{
+    ASSERT_EQ(window.getSupportedResolutions(), std::vector<Resolution>{initialResolution});
+}
\ No newline at end of file
@@ -15,6 +15,7 @@ public:
 
     virtual std::unique_ptr<Window> createWindow(const utils::Vector2u& windowSize,
                                                  const std::string& title) const = 0;
+    virtual std::unique_ptr<Window> createHeadlessWindow(const utils::Vector2u& windowSize) const = 0;
 
     static std::unique_ptr<WindowFactory> createWindowFactory();
 };